@@ -0,0 +1,84 @@
+#include "mcc.h"
+
+// A bump-pointer allocator. Objects are carved out of large blocks and
+// are never freed individually; instead, the whole arena is released at
+// once when the compiler phase that owns it is finished. The arenas of a
+// file are part of its TransUnit.
+
+#define ARENA_BLOCK_SIZE (1024 * 1024)
+
+struct ArenaBlock {
+    ArenaBlock *next;
+    size_t size;
+    char data[];
+};
+
+static void new_block(Arena *arena, size_t min_size) {
+    size_t size = ARENA_BLOCK_SIZE;
+    if (size < min_size)
+        size = min_size;
+
+    // calloc gives us zero-filled memory, so that arena_alloc doesn't
+    // have to clear each object.
+    ArenaBlock *blk = calloc(1, sizeof(ArenaBlock) + size);
+    if (!blk)
+        error("out of memory");
+    blk->size = size;
+    blk->next = arena->blocks;
+    arena->blocks = blk;
+    arena->ptr = blk->data;
+    arena->end = blk->data + size;
+    arena->reserved += size;
+}
+
+// Returns a zero-initialized object of `size` bytes
+void *arena_alloc(Arena *arena, size_t size) {
+    size = (size + 15) & ~(size_t)15;
+    if ((size_t)(arena->end - arena->ptr) < size)
+        new_block(arena, size);
+
+    void *p = arena->ptr;
+    arena->ptr += size;
+    arena->bytes += size;
+    arena->objects++;
+    return p;
+}
+
+char *arena_strndup(Arena *arena, char *p, size_t len) {
+    char *s = arena_alloc(arena, len + 1);
+    memcpy(s, p, len);
+    return s;
+}
+
+// Release all objects but keep the most recent block for reuse. This is
+// for arenas that are refilled over and over, such as the one that holds
+// the instructions of the function being compiled.
+void arena_reset(Arena *arena) {
+    ArenaBlock *blk = arena->blocks;
+    if (!blk)
+        return;
+
+    ArenaBlock *rest = blk->next;
+    while (rest) {
+        ArenaBlock *next = rest->next;
+        free(rest);
+        rest = next;
+    }
+
+    memset(blk->data, 0, arena->ptr - blk->data);
+    blk->next = NULL;
+    arena->ptr = blk->data;
+    arena->end = blk->data + blk->size;
+}
+
+// Release all objects allocated from `arena` in one step
+void arena_free(Arena *arena) {
+    ArenaBlock *blk = arena->blocks;
+    while (blk) {
+        ArenaBlock *next = blk->next;
+        free(blk);
+        blk = next;
+    }
+    arena->blocks = NULL;
+    arena->ptr = arena->end = NULL;
+}
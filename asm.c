@@ -0,0 +1,248 @@
+#include "mcc.h"
+
+// Machine instructions produced by codegen, and their textual form.
+
+static char *reg64_names[] = {"rax", "rcx", "rdx", "rbx", "rsp", "rbp",
+                              "rsi", "rdi", "r8",  "r9",  "r10", "r11",
+                              "r12", "r13", "r14", "r15", "rip"};
+static char *reg8_names[] = {"al",   "cl",   "dl",   "bl",  "spl",  "bpl",
+                             "sil",  "dil",  "r8b",  "r9b", "r10b", "r11b",
+                             "r12b", "r13b", "r14b", "r15b"};
+static char *vec_names[] = {"xmm", "ymm"};
+
+static char *insn_names[] = {
+    [I_PUSH] = "push", [I_POP] = "pop",    [I_MOV] = "mov",
+    [I_MOVSX] = "movsx", [I_MOVZX] = "movzb", [I_LEA] = "lea",
+    [I_ADD] = "add",   [I_SUB] = "sub",    [I_IMUL] = "imul",
+    [I_SHL] = "shl",   [I_SAR] = "sar",    [I_SHR] = "shr",
+    [I_CQO] = "cqo",   [I_IDIV] = "idiv",  [I_NEG] = "neg",
+    [I_CMP] = "cmp",   [I_JMP] = "jmp",    [I_CALL] = "call",
+    [I_RET] = "ret",
+    [I_MOVDQU] = "movdqu", [I_PADDB] = "paddb", [I_PADDQ] = "paddq",
+    [I_PSUBB] = "psubb",   [I_PSUBQ] = "psubq", [I_VZEROUPPER] = "vzeroupper",
+};
+
+static char *cc_names[] = {
+    [CC_E] = "e",   [CC_NE] = "ne", [CC_L] = "l",
+    [CC_GE] = "ge", [CC_LE] = "le", [CC_G] = "g",
+};
+
+Operand reg(Reg r) { return (Operand){OP_REG, 8, r}; }
+
+Operand reg8(Reg r) { return (Operand){OP_REG, 1, r}; }
+
+// Vector register xmm<r> if `size` is 16 or ymm<r> if it is 32
+Operand vec(int r, int size) { return (Operand){OP_REG, size, r}; }
+
+Operand imm(long val) { return (Operand){OP_IMM, 8, .val = val}; }
+
+// Memory operand [base + disp] of `size` bytes
+Operand mem(Reg base, long disp, int size) {
+    return (Operand){OP_MEM, size, base, .val = disp};
+}
+
+// Memory operand [base + index*scale + disp] for lea
+Operand mem_index(Reg base, Reg index, int scale, long disp) {
+    Operand op = mem(base, disp, 8);
+    op.index = index;
+    op.scale = scale;
+    return op;
+}
+
+// RIP-relative reference to a symbol, written sym[rip]
+Operand mem_sym(char *sym) {
+    return (Operand){OP_MEM, 8, RIP, .sym = sym};
+}
+
+// Jump or call target
+Operand label(char *name) { return (Operand){OP_LABEL, 8, .sym = name}; }
+
+Insn *new_insn(Arena *arena, InsnKind kind, Operand dst, Operand src) {
+    Insn *insn = arena_alloc(arena, sizeof(Insn));
+    insn->kind = kind;
+    insn->dst = dst;
+    insn->src = src;
+    return insn;
+}
+
+static void print_reg(OutBuf *buf, int reg, int size) {
+    // Virtual registers only appear in debugging output
+    if (reg >= VREG_BASE) {
+        out_char(buf, 'v');
+        out_int(buf, reg - VREG_BASE);
+        if (size == 1)
+            out_char(buf, 'b');
+        return;
+    }
+    if (size >= 16) {
+        out_str(buf, vec_names[size == 32]);
+        out_int(buf, reg);
+        return;
+    }
+    out_str(buf, size == 1 ? reg8_names[reg] : reg64_names[reg]);
+}
+
+// Returns true if `insn` operates on 32-byte vectors, which takes the
+// AVX form of the instruction
+bool is_avx(Insn *insn) {
+    return (insn->dst.kind == OP_REG && insn->dst.size == 32) ||
+           (insn->src.kind == OP_REG && insn->src.size == 32);
+}
+
+static void print_operand(OutBuf *buf, Insn *insn, Operand *op) {
+    switch (op->kind) {
+    case OP_REG:
+        print_reg(buf, op->reg, op->size);
+        return;
+    case OP_IMM:
+        out_int(buf, op->val);
+        return;
+    case OP_LABEL:
+        out_str(buf, op->sym);
+        return;
+    case OP_MEM:
+        // The size of the memory operand is implied by the other
+        // operand unless that is an immediate or sign- or zero-extended
+        if (insn->kind == I_MOVSX || insn->kind == I_MOVZX ||
+            insn->src.kind == OP_IMM)
+            out_str(buf, op->size == 1 ? "BYTE PTR " : "QWORD PTR ");
+
+        if (op->sym) {
+            out_str(buf, op->sym);
+            out_str(buf, "[rip]");
+            return;
+        }
+
+        out_char(buf, '[');
+        print_reg(buf, op->reg, 8);
+        if (op->scale) {
+            out_str(buf, " + ");
+            print_reg(buf, op->index, 8);
+            out_char(buf, '*');
+            out_int(buf, op->scale);
+        }
+        if (op->val < 0) {
+            out_str(buf, " - ");
+            out_int(buf, -op->val);
+        } else if (op->val > 0) {
+            out_str(buf, " + ");
+            out_int(buf, op->val);
+        }
+        out_char(buf, ']');
+        return;
+    }
+    unreachable();
+}
+
+void print_insn(OutBuf *buf, Insn *insn) {
+    if (insn->kind == I_LABEL) {
+        out_str(buf, insn->dst.sym);
+        out_str(buf, ":\n");
+        return;
+    }
+
+    out_str(buf, "    ");
+    if (insn->kind == I_SETCC || insn->kind == I_JCC) {
+        out_str(buf, insn->kind == I_SETCC ? "set" : "j");
+        out_str(buf, cc_names[insn->cc]);
+    } else {
+        if (is_avx(insn))
+            out_char(buf, 'v');
+        out_str(buf, insn_names[insn->kind]);
+    }
+
+    if (insn->dst.kind != OP_NONE) {
+        out_char(buf, ' ');
+        print_operand(buf, insn, &insn->dst);
+    }
+
+    // AVX arithmetic has a separate destination: vpaddq a, a, b
+    if (is_avx(insn) && insn->kind != I_MOVDQU) {
+        out_str(buf, ", ");
+        print_operand(buf, insn, &insn->dst);
+    }
+    if (insn->src.kind != OP_NONE) {
+        out_str(buf, ", ");
+        print_operand(buf, insn, &insn->src);
+    }
+    out_char(buf, '\n');
+}
+
+static void emit_data(OutBuf *buf, Obj *prog) {
+    for (Obj *var = prog; var; var = var->next) {
+        if (var->is_function)
+            continue;
+
+        out_str(buf, "    .data\n");
+        out_str(buf, "    .globl ");
+        out_str(buf, var->name);
+        out_char(buf, '\n');
+        out_str(buf, var->name);
+        out_str(buf, ":\n");
+
+        if (var->init_data) {
+            for (int i = 0; i < var->ty->size; i++) {
+                out_str(buf, "    .byte ");
+                out_int(buf, var->init_data[i]);
+                out_char(buf, '\n');
+            }
+        } else {
+            out_str(buf, "    .zero ");
+            out_int(buf, var->ty->size);
+            out_char(buf, '\n');
+        }
+    }
+}
+
+typedef struct {
+    Obj **fns;
+    OutBuf *bufs;
+} TextJob;
+
+// Generate the text of one function into its own buffer
+static void gen_text(void *arg, int i, Arena *arena) {
+    TextJob *job = arg;
+    Obj *fn = job->fns[i];
+    OutBuf *buf = &job->bufs[i];
+    out_init(buf, -1);
+    Timer t = timer_start();
+
+    out_str(buf, "    .globl ");
+    out_str(buf, fn->name);
+    out_char(buf, '\n');
+    out_str(buf, "    .text\n");
+    out_str(buf, fn->name);
+    out_str(buf, ":\n");
+
+    for (Insn *insn = codegen(fn, arena); insn; insn = insn->next)
+        print_insn(buf, insn);
+    timer_stop(&t, "function", fn->name);
+}
+
+static void emit_text(OutBuf *buf, Obj *prog) {
+    TextJob job;
+    int n;
+    job.fns = get_functions(prog, &n);
+    job.bufs = calloc(n, sizeof(OutBuf));
+    parallel_for(n, gen_text, &job, &tu->insn_arena);
+
+    for (int i = 0; i < n; i++) {
+        out_mem(buf, job.bufs[i].data, job.bufs[i].len);
+        out_free(&job.bufs[i]);
+    }
+    free(job.bufs);
+}
+
+// Write the program as Intel-syntax assembly
+void emit_asm(Obj *prog, FILE *out) {
+    OutBuf buf;
+    fflush(out);
+    out_init(&buf, fileno(out));
+
+    out_str(&buf, ".intel_syntax noprefix\n");
+    emit_data(&buf, prog);
+    emit_text(&buf, prog);
+
+    out_flush(&buf);
+    out_free(&buf);
+}
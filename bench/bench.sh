@@ -0,0 +1,80 @@
+#!/bin/bash
+# Compile-throughput benchmark. Synthetic inputs generated by bench/gen
+# are compiled with mcc -ftime-report, and the throughput of each phase
+# is reported:
+#
+#   tokenize: tokens/sec   parse: nodes/sec   codegen: bytes of asm/sec
+#
+# Each input is compiled $BENCH_RUNS times and the fastest run is kept.
+# Results are appended to $BENCH_OUT as one JSON object per input,
+# tagged with the commit, so that runs can be compared over time.
+
+cd "$(dirname "$0")/.." || exit
+
+out=${BENCH_OUT:-bench.jsonl}
+runs=${BENCH_RUNS:-3}
+scale=${BENCH_SCALE:-4}
+jobs=${BENCH_JOBS:-1}
+kinds=${BENCH_KINDS:-"expr funcs globals strings locals"}
+
+commit=$(git rev-parse --short HEAD 2>/dev/null || echo unknown)
+date=$(date -u +%Y-%m-%dT%H:%M:%SZ)
+
+dir=$(mktemp -d) || exit
+trap 'rm -rf "$dir"' EXIT
+
+printf "%-8s %9s %9s %9s %12s %12s %14s\n" input "tok ms" "parse ms" \
+    "cg ms" "tokens/s" "nodes/s" "asm bytes/s"
+
+for kind in $kinds; do
+    ./bench/gen $kind $scale > $dir/in.c || exit
+
+    best=
+    for i in $(seq $runs); do
+        if ! ./mcc -j $jobs -ftime-report -o $dir/out.s $dir/in.c \
+            2> $dir/report; then
+            cat $dir/report
+            exit 1
+        fi
+        total=$(awk '$1 == "total" { print $2; exit }' $dir/report)
+        if [ -z "$best" ] || awk "BEGIN { exit !($total < $best) }"; then
+            best=$total
+            cp $dir/report $dir/best
+        fi
+    done
+
+    awk -v kind=$kind -v commit=$commit -v date=$date -v scale=$scale \
+        -v jobs=$jobs -v in_bytes=$(wc -c < $dir/in.c) \
+        -v asm_bytes=$(wc -c < $dir/out.s) -v out="$out" '
+    /^  phase / { in_phase = 1; next }
+    in_phase && $1 == "total" { total = $2; in_phase = 0; next }
+    in_phase { wall[$1] = $2 }
+    /^  tokens / {
+        gsub(",", "")
+        tokens = $2; nodes = $4; types = $6; objects = $8
+    }
+    /^  peak RSS / { rss = $3 }
+
+    function rate(n, ms) { return ms > 0 ? n / (ms / 1000) : 0 }
+
+    END {
+        tps = rate(tokens, wall["tokenize"])
+        nps = rate(nodes, wall["parse"])
+        bps = rate(asm_bytes, wall["codegen"])
+        printf "%-8s %9.2f %9.2f %9.2f %12.0f %12.0f %14.0f\n", kind,
+               wall["tokenize"], wall["parse"], wall["codegen"], tps, nps, bps
+
+        printf "{\"commit\":\"%s\",\"date\":\"%s\",\"input\":\"%s\"," \
+               "\"scale\":%d,\"jobs\":%d,\"input_bytes\":%d," \
+               "\"asm_bytes\":%d,\"tokens\":%d,\"nodes\":%d,\"types\":%d," \
+               "\"objects\":%d,\"tokenize_ms\":%.3f,\"parse_ms\":%.3f," \
+               "\"codegen_ms\":%.3f,\"total_ms\":%.3f," \
+               "\"tokens_per_sec\":%.0f,\"nodes_per_sec\":%.0f," \
+               "\"asm_bytes_per_sec\":%.0f,\"peak_rss_kb\":%d}\n",
+               commit, date, kind, scale, jobs, in_bytes, asm_bytes, tokens,
+               nodes, types, objects, wall["tokenize"], wall["parse"],
+               wall["codegen"], total, tps, nps, bps, rss >> out
+    }' $dir/best
+done
+
+echo "results appended to $out"
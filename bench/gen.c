@@ -0,0 +1,114 @@
+// Generator of synthetic inputs for the compile-throughput benchmark.
+//
+//   gen <kind> [scale]
+//
+// writes a program of the given kind to stdout. Every program stays
+// within the subset of C that mcc accepts. `scale` multiplies the size
+// of the program and defaults to 1.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static int scale = 1;
+
+// Deeply nested expressions
+static void gen_expr(void) {
+    printf("int main() {\n  int x=1;\n");
+    for (int i = 0; i < 200 * scale; i++) {
+        printf("  x=");
+        for (int j = 0; j < 100; j++)
+            printf("(x+%d*", j);
+        printf("1");
+        for (int j = 0; j < 100; j++)
+            printf(")");
+        printf(";\n");
+    }
+    printf("  return x-x;\n}\n");
+}
+
+// Thousands of small functions calling each other
+static void gen_funcs(void) {
+    int n = 5000 * scale;
+    printf("int f0(int a, int b) { return a+b; }\n");
+    for (int i = 1; i < n; i++) {
+        printf("int f%d(int a, int b) {\n", i);
+        printf("  int c=a*%d; int d=b-c; int i;\n", i % 7);
+        printf("  if (c<d) return f%d(c, d);\n", i - 1);
+        printf("  for (i=0; i<a; i=i+1) d=d+i;\n");
+        printf("  return d;\n}\n");
+    }
+    printf("int main() { return f%d(0, 0); }\n", n - 1);
+}
+
+// Huge global arrays
+static void gen_globals(void) {
+    int n = 500 * scale;
+    for (int i = 0; i < n; i++) {
+        printf("int g%d[%d];\n", i, 1000 + i);
+        printf("char c%d[%d];\n", i, 4000 + i);
+    }
+    printf("int main() {\n");
+    for (int i = 0; i < n; i++)
+        printf("  g%d[%d]=c%d[%d];\n", i, i, i, i);
+    printf("  return 0;\n}\n");
+}
+
+// Long string literals
+static void gen_strings(void) {
+    int n = 100 * scale;
+    printf("int main() {\n  char *p;\n");
+    for (int i = 0; i < n; i++) {
+        printf("  p=\"");
+        for (int j = 0; j < 10000; j++)
+            putchar('a' + (i + j) % 26);
+        printf("\";\n");
+    }
+    printf("  return 0;\n}\n");
+}
+
+// Functions with many local variables
+static void gen_locals(void) {
+    int n = 10 * scale;
+    for (int i = 0; i < n; i++) {
+        printf("int f%d() {\n", i);
+        for (int j = 0; j < 2000; j++)
+            printf("  int v%d=%d;\n", j, j);
+        printf("  int s=0;\n");
+        for (int j = 0; j < 2000; j++)
+            printf("  s=s+v%d;\n", j);
+        printf("  return s;\n}\n");
+    }
+    printf("int main() { return f0()-f0(); }\n");
+}
+
+static struct {
+    char *name;
+    void (*fn)(void);
+} kinds[] = {
+    {"expr", gen_expr},       {"funcs", gen_funcs},   {"globals", gen_globals},
+    {"strings", gen_strings}, {"locals", gen_locals},
+};
+
+int main(int argc, char **argv) {
+    int nkinds = sizeof(kinds) / sizeof(*kinds);
+
+    if (argc < 2) {
+        fprintf(stderr, "usage: gen <kind> [scale]\nkinds:");
+        for (int i = 0; i < nkinds; i++)
+            fprintf(stderr, " %s", kinds[i].name);
+        fprintf(stderr, "\n");
+        return 1;
+    }
+    if (argc > 2)
+        scale = atoi(argv[2]);
+
+    for (int i = 0; i < nkinds; i++) {
+        if (!strcmp(argv[1], kinds[i].name)) {
+            kinds[i].fn();
+            return 0;
+        }
+    }
+    fprintf(stderr, "unknown kind: %s\n", argv[1]);
+    return 1;
+}
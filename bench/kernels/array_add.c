@@ -0,0 +1,23 @@
+// Add two global arrays element by element over and over
+int a[4096];
+int b[4096];
+int c[4096];
+
+int bench() {
+    int i;
+    int n;
+    int s;
+
+    for (i = 0; i < 4096; i = i + 1) {
+        b[i] = i;
+        c[i] = i * 3;
+    }
+
+    s = 0;
+    for (n = 0; n < 20000; n = n + 1) {
+        for (i = 0; i < 4096; i = i + 1)
+            a[i] = b[i] + c[i] - a[i];
+        s = s + a[n - n / 4096 * 4096];
+    }
+    return s;
+}
@@ -0,0 +1,22 @@
+// Sum a global array over and over
+int a[10000];
+
+int bench() {
+    int i;
+    int n;
+    int ok;
+
+    for (i = 0; i < 10000; i = i + 1)
+        a[i] = i;
+
+    ok = 0;
+    for (n = 0; n < 2000; n = n + 1) {
+        int s;
+        s = 0;
+        for (i = 0; i < 10000; i = i + 1)
+            s = s + a[i];
+        if (s == 49995000)
+            ok = ok + 1;
+    }
+    return ok;
+}
@@ -0,0 +1,8 @@
+// Naive recursive Fibonacci
+int fib(int n) {
+    if (n < 2)
+        return n;
+    return fib(n - 1) + fib(n - 2);
+}
+
+int bench() { return fib(34); }
@@ -0,0 +1,32 @@
+// Multiply 60x60 matrices with a triple loop
+int a[3600];
+int b[3600];
+int c[3600];
+
+int bench() {
+    int i;
+    int j;
+    int k;
+    int n;
+    int s;
+
+    for (i = 0; i < 3600; i = i + 1) {
+        a[i] = i - i / 7 * 7;
+        b[i] = i - i / 5 * 5;
+    }
+
+    s = 0;
+    for (n = 0; n < 50; n = n + 1) {
+        for (i = 0; i < 60; i = i + 1) {
+            for (j = 0; j < 60; j = j + 1) {
+                int t;
+                t = 0;
+                for (k = 0; k < 60; k = k + 1)
+                    t = t + a[i * 60 + k] * b[k * 60 + j];
+                c[i * 60 + j] = t;
+            }
+        }
+        s = s + c[n];
+    }
+    return s;
+}
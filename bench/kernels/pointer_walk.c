@@ -0,0 +1,34 @@
+// Chase a chain of indices through memory, then walk an array with a
+// pointer
+int next[4096];
+int vals[4096];
+
+int bench() {
+    int i;
+    int n;
+    int s;
+    int *p;
+    int *end;
+
+    for (i = 0; i < 4096; i = i + 1) {
+        int j;
+        j = i + 1597;
+        if (j >= 4096)
+            j = j - 4096;
+        next[i] = j;
+        vals[i] = i - i / 3 * 3;
+    }
+
+    s = 0;
+    i = 0;
+    for (n = 0; n < 5000000; n = n + 1) {
+        s = s + *(vals + i);
+        i = *(next + i);
+    }
+
+    end = vals + 4096;
+    for (n = 0; n < 1000; n = n + 1)
+        for (p = vals; p < end; p = p + 1)
+            s = s + *p;
+    return s;
+}
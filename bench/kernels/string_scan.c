@@ -0,0 +1,28 @@
+// Count the occurrences of a character in a long string
+char buf[65536];
+
+int count(char *p, int c) {
+    int n;
+    n = 0;
+    while (*p) {
+        if (*p == c)
+            n = n + 1;
+        p = p + 1;
+    }
+    return n;
+}
+
+int bench() {
+    int i;
+    int n;
+    int s;
+
+    for (i = 0; i < 65535; i = i + 1)
+        buf[i] = 97 + i - i / 26 * 26;
+    buf[65535] = 0;
+
+    s = 0;
+    for (n = 0; n < 400; n = n + 1)
+        s = s + count(buf, 101);
+    return s;
+}
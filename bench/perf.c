@@ -0,0 +1,69 @@
+// Driver for the runtime benchmark. It is linked with a kernel object,
+// compiled by mcc or by gcc, and measures a call to the kernel's bench()
+// with hardware performance counters. It prints one line:
+//
+//   <checksum> <nanoseconds> <cycles> <instructions> <branch misses>
+//
+// A counter that cannot be opened, e.g. in a container or a VM without
+// PMU access, is printed as -1.
+
+#define _GNU_SOURCE
+#include <linux/perf_event.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+
+int bench(void);
+
+static int open_counter(uint64_t config, int group) {
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.config = config;
+    attr.disabled = group == -1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    return syscall(SYS_perf_event_open, &attr, 0, -1, group, 0);
+}
+
+static long read_counter(int fd) {
+    long val;
+    if (fd == -1 || read(fd, &val, sizeof(val)) != sizeof(val))
+        return -1;
+    return val;
+}
+
+static long now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000000000L + ts.tv_nsec;
+}
+
+int main(void) {
+    // All counters are in one group led by the cycle counter, so that
+    // they are enabled and disabled together
+    int cycles = open_counter(PERF_COUNT_HW_CPU_CYCLES, -1);
+    int insns = -1, misses = -1;
+    if (cycles != -1) {
+        insns = open_counter(PERF_COUNT_HW_INSTRUCTIONS, cycles);
+        misses = open_counter(PERF_COUNT_HW_BRANCH_MISSES, cycles);
+        ioctl(cycles, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+        ioctl(cycles, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    }
+
+    long start = now();
+    int sum = bench();
+    long ns = now() - start;
+
+    if (cycles != -1)
+        ioctl(cycles, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+
+    printf("%d %ld %ld %ld %ld\n", sum, ns, read_counter(cycles),
+           read_counter(insns), read_counter(misses));
+    return 0;
+}
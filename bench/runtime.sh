@@ -0,0 +1,82 @@
+#!/bin/bash
+# Runtime benchmark of generated code. Each kernel in bench/kernels is
+# compiled by mcc, by mcc with its stack-machine codegen (-fno-regalloc),
+# by mcc with -funroll-loops and by gcc -O0 and -O1, linked with
+# bench/perf.c and run under hardware performance counters. Counters
+# that are not available are reported as -1; wall-clock time is always
+# measured.
+#
+# Each configuration runs $BENCH_RUNS times and the fastest run is kept.
+# Results are appended to $BENCH_OUT as one JSON object per kernel and
+# compiler, tagged with the commit.
+
+cd "$(dirname "$0")/.." || exit
+
+out=${BENCH_OUT:-bench-runtime.jsonl}
+runs=${BENCH_RUNS:-3}
+compilers="mcc mcc-stack mcc-unroll gcc-O0 gcc-O1"
+
+commit=$(git rev-parse --short HEAD 2>/dev/null || echo unknown)
+date=$(date -u +%Y-%m-%dT%H:%M:%SZ)
+
+dir=$(mktemp -d) || exit
+trap 'rm -rf "$dir"' EXIT
+
+gcc -O1 -c -o $dir/perf.o bench/perf.c || exit
+
+compile() {
+    case $1 in
+    mcc) ./mcc -c -o $dir/kernel.o $2 ;;
+    mcc-stack) ./mcc -fno-regalloc -c -o $dir/kernel.o $2 ;;
+    mcc-unroll) ./mcc -funroll-loops -c -o $dir/kernel.o $2 ;;
+    gcc-O0) gcc -O0 -w -c -o $dir/kernel.o $2 ;;
+    gcc-O1) gcc -O1 -w -c -o $dir/kernel.o $2 ;;
+    esac
+}
+
+printf "%-14s %-10s %10s %14s %14s %12s %8s\n" kernel cc ms cycles \
+    instructions "br misses" IPC
+
+for file in bench/kernels/*.c; do
+    kernel=$(basename $file .c)
+    expected=
+
+    for compiler in $compilers; do
+        compile $compiler $file || exit
+        gcc -o $dir/run $dir/perf.o $dir/kernel.o || exit
+
+        best=
+        for i in $(seq $runs); do
+            result=$($dir/run) || exit
+            ns=$(echo $result | cut -d' ' -f2)
+            if [ -z "$best" ] || [ $ns -lt $(echo $best | cut -d' ' -f2) ]
+            then
+                best=$result
+            fi
+        done
+
+        set -- $best
+        sum=$1 ns=$2 cycles=$3 insns=$4 misses=$5
+
+        # All compilers must agree on the result
+        if [ -z "$expected" ]; then
+            expected=$sum
+        elif [ "$sum" != "$expected" ]; then
+            echo "$kernel: $compiler returned $sum, expected $expected"
+            exit 1
+        fi
+
+        ipc=$(awk "BEGIN { if ($cycles > 0) printf \"%.2f\", \
+            $insns / $cycles; else print \"-\" }")
+        printf "%-14s %-10s %10.2f %14s %14s %12s %8s\n" $kernel $compiler \
+            $(awk "BEGIN { print $ns / 1e6 }") $cycles $insns $misses $ipc
+
+        printf '{"commit":"%s","date":"%s","kernel":"%s","compiler":"%s",' \
+            $commit $date $kernel $compiler >> $out
+        printf '"result":%d,"ns":%d,"cycles":%d,"instructions":%d,' \
+            $sum $ns $cycles $insns >> $out
+        printf '"branch_misses":%d}\n' $misses >> $out
+    done
+done
+
+echo "results appended to $out"
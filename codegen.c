@@ -1,47 +1,126 @@
 #include "mcc.h"
 
-static FILE *output_file;
-static int depth;
-static char *argreg8[] = {"dil", "sil", "dl", "cl", "r8b", "r9b"};
-static char *argreg64[] = {"rdi", "rsi", "rdx", "rcx", "r8", "r9"};
-static Obj *current_fn;
+// Functions are compiled in one of two ways. By default, a function is
+// lowered to IR, each IR instruction is translated into machine
+// instructions over virtual registers, and regalloc() assigns machine
+// registers afterwards. With -fno-regalloc, the AST is translated
+// directly by a stack machine that keeps the current value in rax and
+// spills to the hardware stack.
+bool opt_regalloc = true;
+
+// State of the function being compiled. Functions are compiled
+// concurrently, so each thread has its own.
+typedef struct {
+    Obj *fn;
+    Arena *arena; // Where instructions and labels are allocated
+    Insn head;
+    Insn *cur;
+    int depth;
+    int count; // Label counter
+    char **labels; // Labels of basic blocks
+    IrInsn **defs; // Defining instruction of each virtual register
+    int *uses;     // Number of instructions that need each one in a register
+    int num_vars;  // Virtual registers of promoted locals; see ir.c
+    int *epochs;   // Epoch of the definition of each one
+    Operand *addrs; // Memory operand for each address folded into it
+    int *vecs;     // Vector register holding each vector value
+    int free_vecs; // Bitmask of unused vector registers
+    bool uses_avx; // AVX code needs vzeroupper before calls and returns
+    char *return_label;
+    char *entry_label; // Where self tail calls jump to, if any
+} Codegen;
+
+static _Thread_local Codegen *cg;
+
+static Reg argreg[] = {RDI, RSI, RDX, RCX, R8, R9};
 
 void gen_expr(Node *node);
+int mul_const_operand(IrInsn *insn);
 
-void println(char *fmt, ...) {
-    va_list ap;
-    va_start(ap, fmt);
-    vfprintf(output_file, fmt, ap);
-    va_end(ap);
-    fprintf(output_file, "\n");
+// Append an instruction to the current function
+Insn *emit2(InsnKind kind, Operand dst, Operand src) {
+    return cg->cur = cg->cur->next = new_insn(cg->arena, kind, dst, src);
 }
 
-int count() {
-    static int i = 1;
-    return i++;
+Insn *emit1(InsnKind kind, Operand dst) {
+    return emit2(kind, dst, (Operand){});
+}
+
+Insn *emit0(InsnKind kind) { return emit2(kind, (Operand){}, (Operand){}); }
+
+void emit_label(char *name) { emit1(I_LABEL, label(name)); }
+
+void emit_jcc(CondCode cc, char *name) { emit1(I_JCC, label(name))->cc = cc; }
+
+// Condition codes come in pairs that differ only in the lowest bit
+CondCode invert_cc(CondCode cc) { return cc ^ 1; }
+
+// Set rax to 1 if the flags satisfy `cc` or to 0 otherwise
+void emit_setcc(CondCode cc) {
+    emit1(I_SETCC, reg8(RAX))->cc = cc;
+    emit2(I_MOVZX, reg(RAX), reg8(RAX));
+}
+
+// Returns a new label such as ".L.else.main.3". Labels are numbered per
+// function, so they don't depend on the order functions are compiled in.
+char *new_label(char *kind) {
+    int len = strlen(kind) + strlen(cg->fn->name) + 16;
+    char *buf = arena_alloc(cg->arena, len);
+    snprintf(buf, len, ".L.%s.%s.%d", kind, cg->fn->name, ++cg->count);
+    return buf;
 }
 
 void push() {
-    println("    push rax");
-    depth++;
+    emit1(I_PUSH, reg(RAX));
+    cg->depth++;
 }
 
-void pop(char *arg) {
-    println("    pop %s", arg);
-    depth--;
+void pop(Reg r) {
+    emit1(I_POP, reg(r));
+    cg->depth--;
 }
 
 int align_to(int n, int align) { return (n + align - 1) / align * align; }
 
+// Free the stack frame. regalloc() restores callee-saved registers
+// before this.
+void emit_leave(void) {
+    emit2(I_MOV, reg(RSP), reg(RBP));
+    emit1(I_POP, reg(RBP));
+    if (cg->uses_avx)
+        emit0(I_VZEROUPPER);
+}
+
+// Leave the frame and jump to `funcname`, which returns to our caller.
+// The arguments are in their registers.
+void emit_tail_jump(char *funcname) {
+    emit_leave();
+    emit2(I_MOV, reg(RAX), imm(0));
+    emit1(I_JMP, label(funcname));
+}
+
+// Evaluate the arguments of a call into their registers
+void gen_args(Node *node) {
+    int nargs = 0;
+    for (Node *arg = node->args; arg; arg = arg->next) {
+        gen_expr(arg);
+        push();
+        nargs++;
+    }
+
+    for (int i = nargs - 1; i >= 0; i--)
+        pop(argreg[i]);
+}
+
 void gen_addr(Node *node) {
     switch (node->kind) {
     case ND_VAR:
         if (node->var->is_local) {
             // Local variable
-            println("    lea rax, [rbp - %d]", node->var->offset);
+            emit2(I_LEA, reg(RAX), mem(RBP, -node->var->offset, 8));
         } else {
             // Global variable
-            println("    lea rax, %s[rip]", node->var->name);
+            emit2(I_LEA, reg(RAX), mem_sym(node->var->name));
         }
         return;
     case ND_DEREF:
@@ -65,29 +144,47 @@ void load(Type *ty) {
     }
 
     if (ty->size == 1)
-        println("    movsx rax, BYTE PTR [rax]");
+        emit2(I_MOVSX, reg(RAX), mem(RAX, 0, 1));
     else
-        println("    mov rax, [rax]");
+        emit2(I_MOV, reg(RAX), mem(RAX, 0, 8));
 }
 
 // Store rax to an address that stack top is pointing to
 void store(Type *ty) {
-    pop("rdi");
+    pop(RDI);
 
     if (ty->size == 1)
-        println("    mov [rdi], al");
+        emit2(I_MOV, mem(RDI, 0, 1), reg8(RAX));
     else
-        println("    mov [rdi], rax");
+        emit2(I_MOV, mem(RDI, 0, 8), reg(RAX));
+}
+
+// Evaluate the operands of a binary operator into rax (lhs) and rdi
+// (rhs), in the order that order.c chose
+void gen_operands(Node *node) {
+    if (node->lhs_first) {
+        gen_expr(node->lhs);
+        push();
+        gen_expr(node->rhs);
+        emit2(I_MOV, reg(RDI), reg(RAX));
+        pop(RAX);
+        return;
+    }
+
+    gen_expr(node->rhs);
+    push();
+    gen_expr(node->lhs);
+    pop(RDI);
 }
 
 void gen_expr(Node *node) {
     switch (node->kind) {
     case ND_NUM:
-        println("    mov rax, %d", node->val);
+        emit2(I_MOV, reg(RAX), imm(node->val));
         return;
     case ND_NEG:
         gen_expr(node->lhs);
-        println("    neg rax");
+        emit1(I_NEG, reg(RAX));
         return;
     case ND_VAR:
         gen_addr(node);
@@ -106,97 +203,780 @@ void gen_expr(Node *node) {
         gen_expr(node->rhs);
         store(node->ty);
         return;
-    case ND_FUNCALL: {
-        int nargs = 0;
-        for (Node *arg = node->args; arg; arg = arg->next) {
-            gen_expr(arg);
-            push();
-            nargs++;
-        }
-
-        for (int i = nargs - 1; i >= 0; i--)
-            pop(argreg64[i]);
-
-        println("    mov rax, 0");
-        println("    call %s", node->funcname);
+    case ND_FUNCALL:
+        gen_args(node);
+        emit2(I_MOV, reg(RAX), imm(0));
+        emit1(I_CALL, label(node->funcname));
         return;
     }
-    }
 
-    gen_expr(node->rhs);
-    push();
-    gen_expr(node->lhs);
-    pop("rdi");
+    gen_operands(node);
 
     switch (node->kind) {
     case ND_ADD:
-        println("    add rax, rdi");
+        emit2(I_ADD, reg(RAX), reg(RDI));
         return;
     case ND_SUB:
-        println("    sub rax, rdi");
+        emit2(I_SUB, reg(RAX), reg(RDI));
         return;
     case ND_MUL:
-        println("    imul rax, rdi");
+        emit2(I_IMUL, reg(RAX), reg(RDI));
         return;
     case ND_DIV:
-        println("    cqo");
-        println("    idiv rdi");
+        emit0(I_CQO);
+        emit1(I_IDIV, reg(RDI));
         return;
     case ND_EQ:
-        println("    cmp rax, rdi");
-        println("    sete al");
-        println("    movzb rax, al");
+        emit2(I_CMP, reg(RAX), reg(RDI));
+        emit_setcc(CC_E);
         return;
     case ND_NE:
-        println("    cmp rax, rdi");
-        println("    setne al");
-        println("    movzb rax, al");
+        emit2(I_CMP, reg(RAX), reg(RDI));
+        emit_setcc(CC_NE);
         return;
     case ND_LT:
-        println("    cmp rax, rdi");
-        println("    setl al");
-        println("    movzb rax, al");
+        emit2(I_CMP, reg(RAX), reg(RDI));
+        emit_setcc(CC_L);
         return;
     case ND_LE:
-        println("    cmp rax, rdi");
-        println("    setle al");
-        println("    movzb rax, al");
+        emit2(I_CMP, reg(RAX), reg(RDI));
+        emit_setcc(CC_LE);
         return;
     }
 
     error_tok(node->tok, "invalid expression");
 }
 
+//
+// Code generation from IR
+//
+
+Operand vreg(int v) { return reg(VREG_BASE + v); }
+
+// The low byte of a register
+Operand low_byte(Operand r) {
+    r.size = 1;
+    return r;
+}
+
+//
+// Instruction selection. Codegen translates one IR instruction at a
+// time, but an operand computed by a simple instruction can often be
+// folded into the instruction that uses it, like a tile covering part
+// of an expression tree:
+//
+//   constants    add v1, 5; cmp v1, 5; mov QWORD PTR [v1], 5
+//   addresses    mov v1, [rbp - 16]; mov v1, x[rip];
+//                mov v1, [v2 + v3*8 + 8]
+//
+// An address computation is folded into a load or store only if it has
+// no other use and is in the same block with no assignment to a
+// promoted local in between, so that its operands still hold the same
+// values. Folded instructions have no uses left in a register and are
+// not generated.
+//
+
+// Returns true if `v` is a constant, and sets *val to its value
+bool is_const(int v, long *val) {
+    IrInsn *def = cg->defs[v];
+    if (v <= cg->num_vars || !def || def->op != IR_IMM)
+        return false;
+    *val = def->imm;
+    return true;
+}
+
+// Returns true if `v` is a constant that fits in a 32-bit immediate, or
+// any constant if `wide`
+bool is_imm(int v, bool wide) {
+    long val;
+    return is_const(v, &val) && (wide || val == (int)val);
+}
+
+// `v` as an immediate if it can be one, or its register
+Operand operand(int v, bool wide) {
+    long val;
+    if (is_imm(v, wide) && is_const(v, &val))
+        return imm(val);
+    return vreg(v);
+}
+
+// Memory operand of `size` bytes at the address `v`
+Operand mem_operand(int v, int size) {
+    Operand op = mem(VREG_BASE + v, 0, size);
+    if (cg->addrs[v].kind == OP_MEM) {
+        op = cg->addrs[v];
+        op.size = size;
+    }
+    return op;
+}
+
+// Returns true if the value `v` can be folded into an instruction of
+// `epoch`; see select_operands()
+static bool is_foldable(int v, int epoch) {
+    return v > cg->num_vars && cg->uses[v] == 1 && cg->epochs[v] == epoch;
+}
+
+// Returns the scale if `v` is i * 1, 2, 4 or 8 that can be folded into
+// an address as the index i, or 0
+static int index_scale(int v, int epoch) {
+    IrInsn *def = cg->defs[v];
+    if (!is_foldable(v, epoch) || !def || def->op != IR_MUL ||
+        mul_const_operand(def) < 0)
+        return 0;
+
+    long scale;
+    is_const(mul_const_operand(def) ? def->b : def->a, &scale);
+    return scale == 1 || scale == 2 || scale == 4 || scale == 8 ? scale : 0;
+}
+
+// Fold the operand `v` of an address addition into `op`, whose kind is
+// OP_NONE until it has a base register. Returns false if `op` has no
+// room for it.
+static bool add_to_addr(Operand *op, int v, int epoch) {
+    IrInsn *def = cg->defs[v];
+    long val;
+    if (is_const(v, &val)) {
+        if (op->val + val != (int)(op->val + val))
+            return false;
+        op->val += val;
+        return true;
+    }
+
+    int scale = index_scale(v, epoch);
+    if (scale) {
+        if (op->scale)
+            return false;
+        op->index = VREG_BASE + (mul_const_operand(def) ? def->a : def->b);
+        op->scale = scale;
+        return true;
+    }
+
+    if (v > cg->num_vars && def && def->op == IR_LVAR) {
+        if (op->kind != OP_NONE)
+            return false;
+        op->kind = OP_MEM;
+        op->reg = RBP;
+        op->val -= def->var->offset;
+        return true;
+    }
+
+    if (op->kind == OP_NONE) {
+        op->kind = OP_MEM;
+        op->reg = VREG_BASE + v;
+        return true;
+    }
+    if (op->scale)
+        return false;
+    op->index = VREG_BASE + v;
+    op->scale = 1;
+    return true;
+}
+
+// The uses of the operand `v` that add_to_addr() folded in
+static void fold_addr_operand(int v, int epoch) {
+    IrInsn *def = cg->defs[v];
+    long val;
+    if (is_const(v, &val) || index_scale(v, epoch) ||
+        (v > cg->num_vars && def && def->op == IR_LVAR))
+        cg->uses[v]--;
+}
+
+// Find the memory operand for the address `v`, used by an instruction
+// of `epoch`
+static void select_addr(int v, int epoch) {
+    IrInsn *def = cg->defs[v];
+    if (v <= cg->num_vars || !def)
+        return;
+
+    switch (def->op) {
+    case IR_LVAR:
+        cg->addrs[v] = mem(RBP, -def->var->offset, 8);
+        cg->uses[v]--;
+        return;
+    case IR_GVAR:
+        cg->addrs[v] = mem_sym(def->var->name);
+        cg->uses[v]--;
+        return;
+    case IR_ADD: {
+        if (!is_foldable(v, epoch))
+            return;
+        Operand op = {};
+        if (!add_to_addr(&op, def->a, epoch) ||
+            !add_to_addr(&op, def->b, epoch) || op.kind == OP_NONE)
+            return;
+
+        // A constant b is an immediate of the addition already
+        fold_addr_operand(def->a, epoch);
+        if (!is_imm(def->b, false))
+            fold_addr_operand(def->b, epoch);
+        cg->addrs[v] = op;
+        cg->uses[v]--;
+        return;
+    }
+    }
+}
+
+// Choose the operands that are folded into the instructions using them.
+// An epoch is a stretch of a block without assignments to promoted
+// locals.
+void select_operands(IrFunc *ir) {
+    int epoch = 0;
+    for (BasicBlock *bb = ir->blocks; bb; bb = bb->next) {
+        epoch++;
+        for (IrInsn *insn = bb->insns; insn; insn = insn->next) {
+            switch (insn->op) {
+            case IR_LOAD:
+            case IR_STORE:
+            case IR_VLOAD:
+            case IR_VSTORE:
+                select_addr(insn->a, epoch);
+                break;
+            }
+
+            if (insn->dst && insn->dst <= cg->num_vars)
+                epoch++;
+            cg->epochs[insn->dst] = epoch;
+        }
+    }
+}
+
+char *block_label(BasicBlock *bb) {
+    int len = strlen(cg->fn->name) + 16;
+    char *buf = arena_alloc(cg->arena, len);
+    snprintf(buf, len, ".L.bb.%s.%d", cg->fn->name, bb->id);
+    return buf;
+}
+
+// Jump to `dest` unless it is the next block in layout order
+void gen_jmp(BasicBlock *bb, BasicBlock *dest) {
+    if (bb->next != dest)
+        emit1(I_JMP, label(cg->labels[dest->id]));
+}
+
+// Returns true if `insn` is a comparison, and sets *cc to the
+// condition under which it is true
+bool is_compare(IrInsn *insn, CondCode *cc) {
+    switch (insn->op) {
+    case IR_EQ:
+        *cc = CC_E;
+        return true;
+    case IR_NE:
+        *cc = CC_NE;
+        return true;
+    case IR_LT:
+        *cc = CC_L;
+        return true;
+    case IR_LE:
+        *cc = CC_LE;
+        return true;
+    }
+    return false;
+}
+
+void gen_cmp(IrInsn *insn) {
+    // A comparison used only by the branch that follows it is generated
+    // by the branch
+    if (!cg->uses[insn->dst])
+        return;
+
+    CondCode cc;
+    is_compare(insn, &cc);
+    Operand dst = vreg(insn->dst);
+    emit2(I_CMP, vreg(insn->a), operand(insn->b, false));
+    emit1(I_SETCC, low_byte(dst))->cc = cc;
+    emit2(I_MOVZX, dst, low_byte(dst));
+}
+
+//
+// Vector operations. Vector values form trees, each used exactly once,
+// so vector registers are simply allocated when a value is defined and
+// freed when it is used, without going through regalloc().
+//
+
+Operand vec_operand(int v) { return vec(cg->vecs[v], vector_size()); }
+
+Operand vec_mem(int addr) { return mem_operand(addr, vector_size()); }
+
+void alloc_vec(int v) {
+    assert(cg->free_vecs);
+    cg->vecs[v] = __builtin_ctz(cg->free_vecs);
+    cg->free_vecs &= ~(1 << cg->vecs[v]);
+}
+
+void free_vec(int v) { cg->free_vecs |= 1 << cg->vecs[v]; }
+
+// dst = a op b, lanewise, in the register of a
+void gen_packed(IrInsn *insn) {
+    InsnKind kind;
+    if (insn->op == IR_VADD)
+        kind = insn->size == 1 ? I_PADDB : I_PADDQ;
+    else
+        kind = insn->size == 1 ? I_PSUBB : I_PSUBQ;
+
+    cg->vecs[insn->dst] = cg->vecs[insn->a];
+    emit2(kind, vec_operand(insn->dst), vec_operand(insn->b));
+    free_vec(insn->b);
+}
+
+// Most operations are two-address on x86: dst = a; dst op= b
+void gen_arith(IrInsn *insn, InsnKind kind) {
+    emit2(I_MOV, vreg(insn->dst), vreg(insn->a));
+    if (insn->b)
+        emit2(kind, vreg(insn->dst), operand(insn->b, false));
+    else
+        emit1(kind, vreg(insn->dst));
+}
+
+//
+// Multiplication and division by constants
+//
+
+static bool is_pow2(unsigned long x) { return x && !(x & (x - 1)); }
+
+static int log2_of(unsigned long x) { return __builtin_ctzl(x); }
+
+// Returns true if multiplying by `c` can be done without imul, that is,
+// if c is 0 or +/-(1, 3, 5 or 9) times a power of two
+static bool is_cheap_mul(long c) {
+    if (c == 0)
+        return true;
+    if (c == LONG_MIN)
+        return true;
+    unsigned long x = c < 0 ? -(unsigned long)c : c;
+    x >>= log2_of(x);
+    return x == 1 || x == 3 || x == 5 || x == 9;
+}
+
+// If `insn` is a multiplication that doesn't need its constant operand
+// in a register, returns the index of that operand (0 for a, 1 for b)
+int mul_const_operand(IrInsn *insn) {
+    long c;
+    if (is_const(insn->b, &c) && (is_cheap_mul(c) || c == (int)c))
+        return 1;
+    if (is_const(insn->a, &c) && (is_cheap_mul(c) || c == (int)c))
+        return 0;
+    return -1;
+}
+
+// Returns true if `insn` is a division by a constant that can be done
+// without idiv
+bool is_div_const(IrInsn *insn) {
+    long c;
+    return is_const(insn->b, &c) && c != 0 && c != LONG_MIN;
+}
+
+// dst = x * c using shifts and lea for small factors. The product
+// wraps around like imul.
+void gen_mul_const(Operand dst, Operand x, long c) {
+    if (c == 0) {
+        emit2(I_MOV, dst, imm(0));
+        return;
+    }
+    if (!is_cheap_mul(c)) {
+        emit2(I_MOV, dst, x);
+        emit2(I_IMUL, dst, imm(c));
+        return;
+    }
+
+    unsigned long u = c < 0 ? -(unsigned long)c : c;
+    int shift = log2_of(u);
+    u >>= shift;
+
+    if (u == 1)
+        emit2(I_MOV, dst, x);
+    else
+        emit2(I_LEA, dst, mem_index(x.reg, x.reg, u - 1, 0));
+    if (shift)
+        emit2(I_SHL, dst, imm(shift));
+    if (c < 0 && c != LONG_MIN)
+        emit1(I_NEG, dst);
+}
+
+// Returns the multiplier m and shift s such that for every x,
+// x / d == hi(x * m) >> s, corrected as in gen_div_const(). This is the
+// algorithm from Hacker's Delight, 10-1, for 64-bit words; 2 <= |d|.
+static long div_magic(long d, int *shift) {
+    unsigned long two63 = 1UL << 63;
+    unsigned long ad = d < 0 ? -(unsigned long)d : d;
+    unsigned long t = two63 + ((unsigned long)d >> 63);
+    unsigned long anc = t - 1 - t % ad;
+    unsigned long q1 = two63 / anc, r1 = two63 - q1 * anc;
+    unsigned long q2 = two63 / ad, r2 = two63 - q2 * ad;
+    unsigned long delta;
+    int p = 63;
+
+    do {
+        p++;
+        q1 *= 2;
+        r1 *= 2;
+        if (r1 >= anc) {
+            q1++;
+            r1 -= anc;
+        }
+        q2 *= 2;
+        r2 *= 2;
+        if (r2 >= ad) {
+            q2++;
+            r2 -= ad;
+        }
+        delta = ad - r2;
+    } while (q1 < delta || (q1 == delta && r1 == 0));
+
+    *shift = p - 64;
+    long m = q2 + 1;
+    return d < 0 ? -m : m;
+}
+
+// dst = x / c, rounded toward zero like idiv
+void gen_div_const(Operand dst, Operand x, long c) {
+    unsigned long u = c < 0 ? -(unsigned long)c : c;
+
+    if (u == 1) {
+        emit2(I_MOV, dst, x);
+    } else if (is_pow2(u)) {
+        // Add 2^k-1 to negative dividends so that the shift rounds
+        // toward zero
+        int k = log2_of(u);
+        emit2(I_MOV, dst, x);
+        emit2(I_SAR, dst, imm(63));
+        emit2(I_SHR, dst, imm(64 - k));
+        emit2(I_ADD, dst, x);
+        emit2(I_SAR, dst, imm(k));
+    } else {
+        int shift;
+        long m = div_magic(c, &shift);
+        emit2(I_MOV, reg(RAX), imm(m));
+        emit1(I_IMUL, x);
+        if (c > 0 && m < 0)
+            emit2(I_ADD, reg(RDX), x);
+        else if (c < 0 && m > 0)
+            emit2(I_SUB, reg(RDX), x);
+        if (shift)
+            emit2(I_SAR, reg(RDX), imm(shift));
+
+        // Add one if the quotient is negative
+        emit2(I_MOV, dst, reg(RDX));
+        emit2(I_SHR, dst, imm(63));
+        emit2(I_ADD, dst, reg(RDX));
+        return;
+    }
+
+    if (c < 0)
+        emit1(I_NEG, dst);
+}
+
+// Returns true if `insn` only computes a value
+static bool is_pure(IrInsn *insn) {
+    switch (insn->op) {
+    case IR_IMM:
+    case IR_ADD:
+    case IR_SUB:
+    case IR_MUL:
+    case IR_NEG:
+    case IR_LVAR:
+    case IR_GVAR:
+    case IR_MOV:
+        return true;
+    }
+    return false;
+}
+
+// `v` as the source of a store of `size` bytes. A byte can be stored
+// from any constant, truncated.
+static Operand store_operand(int v, int size) {
+    Operand op = operand(v, size == 1);
+    if (op.kind == OP_IMM && size == 1)
+        op.val = (signed char)op.val;
+    if (op.kind == OP_REG && size == 1)
+        op = low_byte(op);
+    return op;
+}
+
+void gen_insn(BasicBlock *bb, IrInsn *insn) {
+    Operand dst = vreg(insn->dst);
+
+    // Values that were folded into their uses, and dead ones
+    if (insn->dst > cg->num_vars && !cg->uses[insn->dst] && is_pure(insn))
+        return;
+
+    switch (insn->op) {
+    case IR_IMM:
+        emit2(I_MOV, dst, imm(insn->imm));
+        return;
+    case IR_ADD:
+        gen_arith(insn, I_ADD);
+        return;
+    case IR_SUB:
+        gen_arith(insn, I_SUB);
+        return;
+    case IR_MUL:
+        switch (mul_const_operand(insn)) {
+        case 0:
+            gen_mul_const(dst, vreg(insn->b), cg->defs[insn->a]->imm);
+            return;
+        case 1:
+            gen_mul_const(dst, vreg(insn->a), cg->defs[insn->b]->imm);
+            return;
+        }
+        gen_arith(insn, I_IMUL);
+        return;
+    case IR_NEG:
+        gen_arith(insn, I_NEG);
+        return;
+    case IR_DIV:
+        if (is_div_const(insn)) {
+            gen_div_const(dst, vreg(insn->a), cg->defs[insn->b]->imm);
+            return;
+        }
+        emit2(I_MOV, reg(RAX), vreg(insn->a));
+        emit0(I_CQO);
+        emit1(I_IDIV, vreg(insn->b));
+        emit2(I_MOV, dst, reg(RAX));
+        return;
+    case IR_EQ:
+    case IR_NE:
+    case IR_LT:
+    case IR_LE:
+        gen_cmp(insn);
+        return;
+    case IR_LVAR:
+        emit2(I_LEA, dst, mem(RBP, -insn->var->offset, 8));
+        return;
+    case IR_GVAR:
+        emit2(I_LEA, dst, mem_sym(insn->var->name));
+        return;
+    case IR_MOV: {
+        Operand src = operand(insn->a, true);
+        if (insn->size == 1 && src.kind == OP_IMM)
+            emit2(I_MOV, dst, imm((signed char)src.val));
+        else if (insn->size == 1)
+            emit2(I_MOVSX, dst, low_byte(src));
+        else
+            emit2(I_MOV, dst, src);
+        return;
+    }
+    case IR_PARAM:
+        if (insn->size == 1)
+            emit2(I_MOVSX, dst, reg8(argreg[insn->imm]));
+        else
+            emit2(I_MOV, dst, reg(argreg[insn->imm]));
+        return;
+    case IR_LOAD:
+        if (insn->size == 1)
+            emit2(I_MOVSX, dst, mem_operand(insn->a, 1));
+        else
+            emit2(I_MOV, dst, mem_operand(insn->a, 8));
+        return;
+    case IR_STORE:
+        emit2(I_MOV, mem_operand(insn->a, insn->size),
+              store_operand(insn->b, insn->size));
+        return;
+    case IR_CALL:
+        for (int i = 0; i < insn->nargs; i++)
+            emit2(I_MOV, reg(argreg[i]), operand(insn->args[i], true));
+        if (insn->is_tail) {
+            emit_tail_jump(insn->funcname);
+            return;
+        }
+        if (cg->uses_avx)
+            emit0(I_VZEROUPPER);
+        emit2(I_MOV, reg(RAX), imm(0));
+        emit1(I_CALL, label(insn->funcname));
+        emit2(I_MOV, dst, reg(RAX));
+        return;
+    case IR_JMP:
+        gen_jmp(bb, insn->then);
+        return;
+    case IR_BR: {
+        IrInsn *cond = cg->defs[insn->a];
+        CondCode cc = CC_NE;
+        if (!cg->uses[insn->a] && is_compare(cond, &cc))
+            emit2(I_CMP, vreg(cond->a), operand(cond->b, false));
+        else
+            emit2(I_CMP, vreg(insn->a), imm(0));
+
+        if (bb->next == insn->els) {
+            emit_jcc(cc, cg->labels[insn->then->id]);
+            return;
+        }
+        emit_jcc(invert_cc(cc), cg->labels[insn->els->id]);
+        gen_jmp(bb, insn->then);
+        return;
+    }
+    case IR_RET:
+        // The function has already left if this returns a tail call
+        if (insn->a && cg->defs[insn->a]->op == IR_CALL &&
+            cg->defs[insn->a]->is_tail)
+            return;
+        if (insn->a)
+            emit2(I_MOV, reg(RAX), operand(insn->a, true));
+        if (bb->next)
+            emit1(I_JMP, label(cg->return_label));
+        return;
+    case IR_VLOAD:
+        alloc_vec(insn->dst);
+        emit2(I_MOVDQU, vec_operand(insn->dst), vec_mem(insn->a));
+        return;
+    case IR_VSTORE:
+        emit2(I_MOVDQU, vec_mem(insn->a), vec_operand(insn->b));
+        free_vec(insn->b);
+        return;
+    case IR_VADD:
+    case IR_VSUB:
+        gen_packed(insn);
+        return;
+    }
+    unreachable();
+}
+
+// Don't count constants that can be immediate operands of `insn`
+static void count_imm_operands(IrInsn *insn) {
+    switch (insn->op) {
+    case IR_ADD:
+    case IR_SUB:
+    case IR_EQ:
+    case IR_NE:
+    case IR_LT:
+    case IR_LE:
+        if (is_imm(insn->b, false))
+            cg->uses[insn->b]--;
+        return;
+    case IR_STORE:
+        if (is_imm(insn->b, insn->size == 1))
+            cg->uses[insn->b]--;
+        return;
+    case IR_MOV:
+    case IR_RET:
+        if (is_imm(insn->a, true))
+            cg->uses[insn->a]--;
+        return;
+    case IR_CALL:
+        for (int i = 0; i < insn->nargs; i++)
+            if (is_imm(insn->args[i], true))
+                cg->uses[insn->args[i]]--;
+        return;
+    }
+}
+
+// Find the definition of each virtual register and count the
+// instructions that need it in a register
+void count_uses(IrFunc *ir) {
+    int n = ir->num_vregs + 1;
+    cg->num_vars = ir->num_vars;
+    cg->defs = arena_alloc(cg->arena, sizeof(IrInsn *) * n);
+    cg->uses = arena_alloc(cg->arena, sizeof(int) * n);
+    cg->vecs = arena_alloc(cg->arena, sizeof(int) * n);
+    cg->epochs = arena_alloc(cg->arena, sizeof(int) * n);
+    cg->addrs = arena_alloc(cg->arena, sizeof(Operand) * n);
+    cg->free_vecs = 0xffff;
+
+    for (BasicBlock *bb = ir->blocks; bb; bb = bb->next) {
+        IrInsn *prev = NULL;
+        for (IrInsn *insn = bb->insns; insn; prev = insn, insn = insn->next) {
+            cg->defs[insn->dst] = insn;
+            if (insn->op >= IR_VLOAD && vector_size() == 32)
+                cg->uses_avx = true;
+
+            // Only the second operand can be an immediate
+            if ((insn->op == IR_ADD || insn->op == IR_EQ ||
+                 insn->op == IR_NE) &&
+                is_imm(insn->a, false) && !is_imm(insn->b, false)) {
+                int a = insn->a;
+                insn->a = insn->b;
+                insn->b = a;
+            }
+
+            cg->uses[insn->a]++;
+            cg->uses[insn->b]++;
+            for (int i = 0; i < insn->nargs; i++)
+                cg->uses[insn->args[i]]++;
+
+            if (insn->op == IR_MUL && mul_const_operand(insn) >= 0)
+                cg->uses[mul_const_operand(insn) ? insn->b : insn->a]--;
+            if (insn->op == IR_DIV && is_div_const(insn))
+                cg->uses[insn->b]--;
+            count_imm_operands(insn);
+
+            // Fuse a comparison with the branch right after it, so that
+            // nothing in between can change the flags
+            CondCode cc;
+            if (insn->op == IR_BR && prev && prev->dst == insn->a &&
+                cg->uses[insn->a] == 1 && is_compare(prev, &cc))
+                cg->uses[insn->a]--;
+        }
+    }
+}
+
+void gen_ir(IrFunc *ir) {
+    cg->labels = arena_alloc(cg->arena, sizeof(char *) * ir->num_blocks);
+    for (BasicBlock *bb = ir->blocks; bb; bb = bb->next)
+        cg->labels[bb->id] = block_label(bb);
+    count_uses(ir);
+    select_operands(ir);
+
+    for (BasicBlock *bb = ir->blocks; bb; bb = bb->next) {
+        emit_label(cg->labels[bb->id]);
+        for (IrInsn *insn = bb->insns; insn; insn = insn->next)
+            gen_insn(bb, insn);
+    }
+}
+
+// Jump to `label` if `cond` is false. A comparison jumps on the flags it
+// sets instead of computing 0 or 1 and comparing that.
+void gen_branch_if_false(Node *cond, char *label) {
+    CondCode cc;
+    switch (cond->kind) {
+    case ND_EQ:
+        cc = CC_E;
+        break;
+    case ND_NE:
+        cc = CC_NE;
+        break;
+    case ND_LT:
+        cc = CC_L;
+        break;
+    case ND_LE:
+        cc = CC_LE;
+        break;
+    default:
+        gen_expr(cond);
+        emit2(I_CMP, reg(RAX), imm(0));
+        emit_jcc(CC_E, label);
+        return;
+    }
+
+    gen_operands(cond);
+    emit2(I_CMP, reg(RAX), reg(RDI));
+    emit_jcc(invert_cc(cc), label);
+}
+
 void gen_stmt(Node *node) {
     switch (node->kind) {
     case ND_IF: {
-        int c = count();
-        gen_expr(node->cond);
-        println("    cmp rax, 0");
-        println("    je .L.else.%d", c);
+        char *els = new_label("else");
+        char *end = new_label("end");
+        gen_branch_if_false(node->cond, els);
         gen_stmt(node->then);
-        println("    jmp .L.end.%d", c);
-        println(".L.else.%d:", c);
+        emit1(I_JMP, label(end));
+        emit_label(els);
         if (node->els)
             gen_stmt(node->els);
-        println(".L.end.%d:", c);
+        emit_label(end);
         return;
     }
     case ND_FOR: {
-        int c = count();
+        char *begin = new_label("begin");
+        char *end = new_label("end");
         if (node->init)
             gen_stmt(node->init);
-        println(".L.begin.%d:", c);
-        if (node->cond) {
-            gen_expr(node->cond);
-            println("    cmp rax, 0");
-            println("    je .L.end.%d", c);
-        }
+        emit_label(begin);
+        if (node->cond)
+            gen_branch_if_false(node->cond, end);
         gen_stmt(node->then);
         if (node->inc)
             gen_expr(node->inc);
-        println("    jmp .L.begin.%d", c);
-        println(".L.end.%d:", c);
+        emit1(I_JMP, label(begin));
+        emit_label(end);
         return;
     }
     case ND_BLOCK:
@@ -204,8 +984,16 @@ void gen_stmt(Node *node) {
             gen_stmt(n);
         return;
     case ND_RETURN:
+        if (is_tail_call(node->lhs, cg->fn)) {
+            gen_args(node->lhs);
+            if (is_self_tail_call(node->lhs, cg->fn))
+                emit1(I_JMP, label(cg->entry_label));
+            else
+                emit_tail_jump(node->lhs->funcname);
+            return;
+        }
         gen_expr(node->lhs);
-        println("    jmp .L.return.%s", current_fn->name);
+        emit1(I_JMP, label(cg->return_label));
         return;
     case ND_EXPR_STMT:
         gen_expr(node->lhs);
@@ -215,75 +1003,91 @@ void gen_stmt(Node *node) {
     error_tok(node->tok, "invalid statement");
 }
 
-// Assign offsets to local variables
-void assign_lvar_offsets(Obj *prog) {
-    for (Obj *fn = prog; fn; fn = fn->next) {
-        int offset = 0;
-        for (Obj *var = fn->locals; var; var = var->next) {
-            offset += var->ty->size;
-            var->offset = offset;
-        }
-        fn->stack_size = align_to(offset, 16);
+// Assign offsets to local variables. Locals that the IR keeps in
+// registers need none.
+void assign_lvar_offsets(Obj *fn) {
+    int offset = 0;
+    for (Obj *var = fn->locals; var; var = var->next) {
+        if (opt_regalloc && is_promoted(var))
+            continue;
+        offset += var->ty->size;
+        var->offset = offset;
     }
+    fn->stack_size = align_to(offset, 16);
 }
 
-void emit_data(Obj *prog) {
-    for (Obj *var = prog; var; var = var->next) {
+// Returns the functions of the program in source order
+Obj **get_functions(Obj *prog, int *n) {
+    *n = 0;
+    for (Obj *var = prog; var; var = var->next)
         if (var->is_function)
-            continue;
+            (*n)++;
+
+    Obj **fns = arena_alloc(&tu->code_arena, sizeof(Obj *) * *n);
+    int i = 0;
+    for (Obj *var = prog; var; var = var->next)
+        if (var->is_function)
+            fns[i++] = var;
+    return fns;
+}
 
-        println("    .data");
-        println("    .globl %s", var->name);
-        println("%s:", var->name);
+// Translate a function into a list of machine instructions. The list is
+// allocated in `arena`, which the caller resets once it has emitted the
+// function. This may be called from several threads at once.
+Insn *codegen(Obj *fn, Arena *arena) {
+    Codegen ctx = {fn, arena};
+    ctx.cur = &ctx.head;
+    cg = &ctx;
 
-        if (var->init_data) {
-            for (int i = 0; i < var->ty->size; i++)
-                println("    .byte %d", var->init_data[i]);
-        } else {
-            println("    .zero %d", var->ty->size);
-        }
+    int len = strlen(fn->name) + 11;
+    cg->return_label = arena_alloc(arena, len);
+    snprintf(cg->return_label, len, ".L.return.%s", fn->name);
+    assign_lvar_offsets(fn);
+
+    // Prologue
+    emit1(I_PUSH, reg(RBP));
+    emit2(I_MOV, reg(RBP), reg(RSP));
+    Insn *frame = emit2(I_SUB, reg(RSP), imm(fn->stack_size));
+
+    // The stack machine runs a self tail call by storing the arguments
+    // as on entry
+    if (!opt_regalloc && has_self_tail_call(fn->body, fn)) {
+        cg->entry_label = new_label("entry");
+        emit_label(cg->entry_label);
     }
-}
 
-void emit_text(Obj *prog) {
-    for (Obj *fn = prog; fn; fn = fn->next) {
-        if (!fn->is_function)
+    // Store parameters in their stack slots. Promoted ones are read from
+    // their registers by IR_PARAM instead.
+    int i = 0;
+    for (Obj *var = fn->params; var; var = var->next, i++) {
+        if (opt_regalloc && is_promoted(var))
             continue;
-        println("    .globl %s", fn->name);
-        println("    .text");
-        println("%s:", fn->name);
-        current_fn = fn;
-
-        // Prologue
-        println("    push rbp");
-        println("    mov rbp, rsp");
-        println("    sub rsp, %d", fn->stack_size);
-
-        int i = 0;
-        for (Obj *var = fn->params; var; var = var->next) {
-            if (var->ty->size == 1)
-                println("    mov [rbp - %d], %s", var->offset, argreg8[i++]);
-            else
-                println("    mov [rbp - %d], %s", var->offset, argreg64[i++]);
-        }
+        if (var->ty->size == 1)
+            emit2(I_MOV, mem(RBP, -var->offset, 1), reg8(argreg[i]));
+        else
+            emit2(I_MOV, mem(RBP, -var->offset, 8), reg(argreg[i]));
+    }
 
-        // Emit code
+    // Emit code
+    IrFunc *ir = NULL;
+    if (opt_regalloc) {
+        ir = build_ir(fn, arena);
+        gen_ir(ir);
+    } else {
         gen_stmt(fn->body);
-        assert(depth == 0);
-
-        // Epilogue
-        println(".L.return.%s:", fn->name);
-        println("    mov rsp, rbp");
-        println("    pop rbp");
-        println("    ret");
+        assert(cg->depth == 0);
     }
-}
 
-void codegen(Obj *prog, FILE *out) {
-    output_file = out;
+    // Epilogue
+    emit_label(cg->return_label);
+    emit_leave();
+    emit0(I_RET);
+
+    if (opt_regalloc)
+        regalloc(ctx.head.next, ir->num_vregs + 1, frame, arena);
+    if (opt_peephole)
+        peephole(&ctx.head.next);
 
-    assign_lvar_offsets(prog);
-    println(".intel_syntax noprefix");
-    emit_data(prog);
-    emit_text(prog);
-}
\ No newline at end of file
+    cg = NULL;
+    return ctx.head.next;
+}
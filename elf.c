@@ -0,0 +1,185 @@
+#include "mcc.h"
+
+// ELF64 relocatable object file writer.
+//
+// The file consists of the ELF header followed by section contents and
+// the section header table:
+//
+//   .text .data .rela.text .symtab .strtab .shstrtab .note.GNU-stack
+
+enum {
+    IDX_TEXT = 1,
+    IDX_DATA,
+    IDX_RELA_TEXT,
+    IDX_SYMTAB,
+    IDX_STRTAB,
+    IDX_SHSTRTAB,
+    IDX_NOTE_STACK,
+    NUM_SECTIONS,
+};
+
+// Append a string to a string table and return its offset
+static int add_string(OutBuf *strtab, char *s) {
+    int off = strtab->len;
+    out_mem(strtab, s, strlen(s) + 1);
+    return off;
+}
+
+static void add_section(Elf64_Shdr *shdr, OutBuf *shstrtab, char *name,
+                        int type, int flags, long offset, long size,
+                        int align) {
+    shdr->sh_name = add_string(shstrtab, name);
+    shdr->sh_type = type;
+    shdr->sh_flags = flags;
+    shdr->sh_offset = offset;
+    shdr->sh_size = size;
+    shdr->sh_addralign = align;
+}
+
+static void write_symbol(OutBuf *symtab, OutBuf *strtab, Symbol *sym) {
+    Elf64_Sym esym = {};
+    esym.st_name = add_string(strtab, sym->name);
+    esym.st_value = sym->offset;
+    esym.st_size = sym->size;
+
+    int bind = sym->is_local ? STB_LOCAL : STB_GLOBAL;
+    int type = STT_NOTYPE;
+    if (sym->section == SEC_TEXT) {
+        esym.st_shndx = IDX_TEXT;
+        type = STT_FUNC;
+    } else if (sym->section == SEC_DATA) {
+        esym.st_shndx = IDX_DATA;
+        type = STT_OBJECT;
+    }
+    esym.st_info = ELF64_ST_INFO(bind, type);
+    out_mem(symtab, (char *)&esym, sizeof(esym));
+}
+
+// Write an assembled program as an ELF relocatable object
+static void write_elf(ObjFile *obj, FILE *out) {
+    OutBuf buf, symtab, strtab, shstrtab;
+    out_init(&buf, fileno(out));
+    out_init(&symtab, -1);
+    out_init(&strtab, -1);
+    out_init(&shstrtab, -1);
+    out_char(&strtab, 0);
+    out_char(&shstrtab, 0);
+
+    // The symbol table lists local symbols before global ones
+    Elf64_Sym null_sym = {};
+    out_mem(&symtab, (char *)&null_sym, sizeof(null_sym));
+    int nsyms = 1;
+
+    for (Symbol *sym = obj->syms; sym; sym = sym->next)
+        if (sym->is_local)
+            sym->index = nsyms++;
+    int first_global = nsyms;
+    for (Symbol *sym = obj->syms; sym; sym = sym->next)
+        if (!sym->is_local)
+            sym->index = nsyms++;
+
+    for (Symbol *sym = obj->syms; sym; sym = sym->next)
+        if (sym->is_local)
+            write_symbol(&symtab, &strtab, sym);
+    for (Symbol *sym = obj->syms; sym; sym = sym->next)
+        if (!sym->is_local)
+            write_symbol(&symtab, &strtab, sym);
+
+    OutBuf rela;
+    out_init(&rela, -1);
+    for (Reloc *rel = obj->relocs; rel; rel = rel->next) {
+        Elf64_Rela erel = {};
+        erel.r_offset = rel->offset;
+        erel.r_info = ELF64_R_INFO(rel->sym->index, rel->type);
+        erel.r_addend = rel->addend;
+        out_mem(&rela, (char *)&erel, sizeof(erel));
+    }
+
+    // Lay out the file
+    Elf64_Shdr shdr[NUM_SECTIONS] = {};
+    long off = sizeof(Elf64_Ehdr);
+
+    Elf64_Ehdr ehdr = {};
+    memcpy(ehdr.e_ident, ELFMAG, SELFMAG);
+    ehdr.e_ident[EI_CLASS] = ELFCLASS64;
+    ehdr.e_ident[EI_DATA] = ELFDATA2LSB;
+    ehdr.e_ident[EI_VERSION] = EV_CURRENT;
+    ehdr.e_ident[EI_OSABI] = ELFOSABI_SYSV;
+    ehdr.e_type = ET_REL;
+    ehdr.e_machine = EM_X86_64;
+    ehdr.e_version = EV_CURRENT;
+    ehdr.e_ehsize = sizeof(Elf64_Ehdr);
+    ehdr.e_shentsize = sizeof(Elf64_Shdr);
+    ehdr.e_shnum = NUM_SECTIONS;
+    ehdr.e_shstrndx = IDX_SHSTRTAB;
+
+    OutBuf *contents[NUM_SECTIONS] = {
+        [IDX_TEXT] = &obj->text, [IDX_DATA] = &obj->data,
+        [IDX_RELA_TEXT] = &rela, [IDX_SYMTAB] = &symtab,
+        [IDX_STRTAB] = &strtab,
+    };
+
+    add_section(&shdr[IDX_TEXT], &shstrtab, ".text", SHT_PROGBITS,
+                SHF_ALLOC | SHF_EXECINSTR, 0, obj->text.len, 16);
+    add_section(&shdr[IDX_DATA], &shstrtab, ".data", SHT_PROGBITS,
+                SHF_ALLOC | SHF_WRITE, 0, obj->data.len, 8);
+    add_section(&shdr[IDX_RELA_TEXT], &shstrtab, ".rela.text", SHT_RELA,
+                SHF_INFO_LINK, 0, rela.len, 8);
+    shdr[IDX_RELA_TEXT].sh_link = IDX_SYMTAB;
+    shdr[IDX_RELA_TEXT].sh_info = IDX_TEXT;
+    shdr[IDX_RELA_TEXT].sh_entsize = sizeof(Elf64_Rela);
+    add_section(&shdr[IDX_SYMTAB], &shstrtab, ".symtab", SHT_SYMTAB, 0, 0,
+                symtab.len, 8);
+    shdr[IDX_SYMTAB].sh_link = IDX_STRTAB;
+    shdr[IDX_SYMTAB].sh_info = first_global;
+    shdr[IDX_SYMTAB].sh_entsize = sizeof(Elf64_Sym);
+    add_section(&shdr[IDX_STRTAB], &shstrtab, ".strtab", SHT_STRTAB, 0, 0,
+                strtab.len, 1);
+    add_section(&shdr[IDX_NOTE_STACK], &shstrtab, ".note.GNU-stack",
+                SHT_PROGBITS, 0, 0, 0, 1);
+    add_section(&shdr[IDX_SHSTRTAB], &shstrtab, ".shstrtab", SHT_STRTAB, 0,
+                0, 0, 1);
+    shdr[IDX_SHSTRTAB].sh_size = shstrtab.len;
+    contents[IDX_SHSTRTAB] = &shstrtab;
+
+    for (int i = 1; i < NUM_SECTIONS; i++) {
+        long align = shdr[i].sh_addralign;
+        off = (off + align - 1) / align * align;
+        shdr[i].sh_offset = off;
+        off += shdr[i].sh_size;
+    }
+    off = (off + 7) / 8 * 8;
+    ehdr.e_shoff = off;
+
+    // Emit everything in file order
+    out_mem(&buf, (char *)&ehdr, sizeof(ehdr));
+    long pos = sizeof(ehdr);
+    for (int i = 1; i < NUM_SECTIONS; i++) {
+        for (; pos < shdr[i].sh_offset; pos++)
+            out_char(&buf, 0);
+        if (contents[i]) {
+            out_mem(&buf, contents[i]->data, contents[i]->len);
+            pos += contents[i]->len;
+        }
+    }
+    for (; pos < ehdr.e_shoff; pos++)
+        out_char(&buf, 0);
+    out_mem(&buf, (char *)shdr, sizeof(shdr));
+
+    out_flush(&buf);
+    out_free(&buf);
+    out_free(&rela);
+    out_free(&symtab);
+    out_free(&strtab);
+    out_free(&shstrtab);
+}
+
+// Write the program as an ELF relocatable object file
+void emit_obj(Obj *prog, FILE *out) {
+    fflush(out);
+    ObjFile *obj = assemble(prog);
+    write_elf(obj, out);
+    out_free(&obj->text);
+    out_free(&obj->data);
+    hashmap_free(&obj->symtab);
+}
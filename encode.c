@@ -0,0 +1,527 @@
+#include "mcc.h"
+
+// x86-64 instruction encoder. This translates the instruction lists
+// produced by codegen into machine code, so that we can write object
+// files without running an external assembler.
+//
+// Jumps and calls always use the rel32 form. Jumps to .L labels are
+// resolved here; references to other symbols become relocations.
+//
+// Functions are encoded in parallel, each into its own buffer. Their
+// relocations refer to symbols by name and are turned into Reloc
+// records when the buffers are concatenated in source order.
+
+typedef struct {
+    long offset; // Relative to the start of the function
+    char *name;
+    int type;
+    long addend;
+} FuncReloc;
+
+typedef struct {
+    OutBuf text;
+    OutBuf relocs; // Array of FuncReloc
+} FuncCode;
+
+// State of the function being encoded on this thread
+static _Thread_local FuncCode *fc;
+static _Thread_local OutBuf *text;
+static _Thread_local Arena *scratch;
+
+// Label name -> offset in .text plus one, so that no value is NULL.
+// Labels are local to a function, so this is cleared for each one.
+static _Thread_local HashMap labels;
+
+// A rel32 field that refers to a local label
+typedef struct Fixup Fixup;
+struct Fixup {
+    Fixup *next;
+    long offset;
+    char *label;
+};
+
+static _Thread_local Fixup *fixups;
+
+static void byte(int b) { out_char(text, b); }
+
+static void imm32(long val) {
+    for (int i = 0; i < 4; i++)
+        byte((val >> (i * 8)) & 0xff);
+}
+
+static void imm64(long val) {
+    for (int i = 0; i < 8; i++)
+        byte((val >> (i * 8)) & 0xff);
+}
+
+static bool is_imm8(long val) { return val == (signed char)val; }
+
+static bool is_imm32(long val) { return val == (int)val; }
+
+static bool is_local_label(char *name) { return !strncmp(name, ".L", 2); }
+
+// Find a symbol by name, creating an undefined one if necessary
+Symbol *get_symbol(ObjFile *obj, char *name) {
+    int len = strlen(name);
+    Symbol *sym = hashmap_get2(&obj->symtab, name, len);
+    if (sym)
+        return sym;
+
+    sym = arena_alloc(&tu->code_arena, sizeof(Symbol));
+    sym->name = name;
+    sym->section = SEC_UNDEF;
+    sym->is_local = is_local_label(name);
+    hashmap_put2(&obj->symtab, name, len, sym);
+
+    *obj->syms_tail = sym;
+    obj->syms_tail = &sym->next;
+    return sym;
+}
+
+static void add_reloc(long offset, char *name, int type, long addend) {
+    FuncReloc rel = {offset, name, type, addend};
+    out_mem(&fc->relocs, (char *)&rel, sizeof(rel));
+}
+
+// Emit a rel32 field pointing to a label or a symbol
+static void rel32(char *name, int type) {
+    if (is_local_label(name)) {
+        Fixup *fx = arena_alloc(scratch, sizeof(Fixup));
+        fx->offset = text->len;
+        fx->label = name;
+        fx->next = fixups;
+        fixups = fx;
+    } else {
+        add_reloc(text->len, name, type, -4);
+    }
+    imm32(0);
+}
+
+static bool is_byte_reg(Operand *op) {
+    return op->kind == OP_REG && op->size == 1;
+}
+
+// Emit ModRM [SIB] [disp]. `r` goes in the reg field; it is either a
+// register or an opcode extension. `rm` is a register or memory operand.
+// `imm_size` is the size of an immediate that follows the instruction,
+// which a RIP-relative displacement has to skip over.
+static void modrm(int r, Operand *rm, int imm_size) {
+    r &= 7;
+
+    if (rm->kind == OP_REG) {
+        byte(0xc0 | (r << 3) | (rm->reg & 7));
+        return;
+    }
+
+    assert(rm->kind == OP_MEM);
+
+    if (rm->reg == RIP) {
+        byte((r << 3) | 5);
+        add_reloc(text->len, rm->sym, R_X86_64_PC32, -4 - imm_size);
+        imm32(0);
+        return;
+    }
+
+    // rbp and r13 as a base always need a displacement, and rsp and r12
+    // as a base always need a SIB byte, as does an index register.
+    int base = rm->reg & 7;
+    long disp = rm->val;
+    int mod;
+    if (disp == 0 && base != RBP)
+        mod = 0;
+    else if (is_imm8(disp))
+        mod = 1;
+    else
+        mod = 2;
+
+    if (rm->scale) {
+        int ss = rm->scale == 8 ? 3 : rm->scale == 4 ? 2 : rm->scale / 2;
+        byte((mod << 6) | (r << 3) | 4);
+        byte((ss << 6) | ((rm->index & 7) << 3) | base);
+    } else {
+        byte((mod << 6) | (r << 3) | base);
+        if (base == RSP)
+            byte(0x24);
+    }
+
+    if (mod == 1)
+        byte(disp);
+    else if (mod == 2)
+        imm32(disp);
+}
+
+// The high bits of the registers in `rm`, for REX.B and REX.X
+static int rm_ext_b(Operand *rm) {
+    if (rm->kind == OP_REG || (rm->kind == OP_MEM && rm->reg != RIP))
+        return rm->reg >> 3;
+    return 0;
+}
+
+static int rm_ext_x(Operand *rm) {
+    return rm->kind == OP_MEM && rm->scale ? rm->index >> 3 : 0;
+}
+
+// Emit an instruction of the form [REX] opcode ModRM [SIB] [disp].
+//
+// `w` requests 64-bit operand size and `r_byte` tells that `r` is an
+// 8-bit register. See modrm() for the other arguments.
+static void encode_rm(int opcode, bool w, int r, bool r_byte, Operand *rm,
+                      int imm_size) {
+    int rex = 0x40 | (w << 3) | ((r >> 3) << 2);
+    rex |= rm_ext_b(rm) | (rm_ext_x(rm) << 1);
+
+    // Without a REX prefix, encodings 4-7 of 8-bit registers select
+    // ah/ch/dh/bh instead of spl/bpl/sil/dil.
+    bool need_rex = rex != 0x40;
+    if (r_byte && r >= 4)
+        need_rex = true;
+    if (is_byte_reg(rm) && rm->reg >= 4)
+        need_rex = true;
+    if (need_rex)
+        byte(rex);
+
+    if (opcode > 0xff)
+        byte(opcode >> 8);
+    byte(opcode & 0xff);
+    modrm(r, rm, imm_size);
+}
+
+// Emit an AVX instruction on 256-bit vectors in the 0F opcode map. `pp`
+// stands for the prefix of the SSE form (1 for 66, 2 for F3), and `v` is
+// the first source register of a three-operand instruction.
+static void encode_vex(int pp, int opcode, int r, int v, Operand *rm) {
+    int x = rm_ext_x(rm);
+    int b = rm_ext_b(rm);
+    int vlp = ((~v & 15) << 3) | 4 | pp;
+
+    // The two-byte form has no room for the X and B bits
+    if (!x && !b) {
+        byte(0xc5);
+        byte((~r >> 3 & 1) << 7 | vlp);
+    } else {
+        byte(0xc4);
+        byte((~r >> 3 & 1) << 7 | !x << 6 | !b << 5 | 1);
+        byte(vlp);
+    }
+    byte(opcode);
+    modrm(r, rm, 0);
+}
+
+// Packed integer arithmetic: 66 0F op for SSE2, or VEX.256.66.0F op
+static void encode_packed(Insn *insn, int opcode) {
+    Operand *dst = &insn->dst;
+    if (is_avx(insn)) {
+        encode_vex(1, opcode, dst->reg, dst->reg, &insn->src);
+        return;
+    }
+    byte(0x66);
+    encode_rm(0x0f00 | opcode, false, dst->reg, false, &insn->src, 0);
+}
+
+static void encode_movdqu(Insn *insn) {
+    // Load: F3 0F 6F, store: F3 0F 7F
+    bool load = insn->dst.kind == OP_REG;
+    Operand *r = load ? &insn->dst : &insn->src;
+    Operand *rm = load ? &insn->src : &insn->dst;
+    int opcode = load ? 0x6f : 0x7f;
+
+    if (is_avx(insn)) {
+        encode_vex(2, opcode, r->reg, 0, rm);
+        return;
+    }
+    byte(0xf3);
+    encode_rm(0x0f00 | opcode, false, r->reg, false, rm, 0);
+}
+
+// add, sub and cmp share their encodings except for one field
+static void encode_alu(Insn *insn, int ext) {
+    Operand *dst = &insn->dst;
+    Operand *src = &insn->src;
+
+    if (src->kind == OP_IMM) {
+        if (is_imm8(src->val)) {
+            encode_rm(0x83, true, ext, false, dst, 1);
+            byte(src->val);
+        } else {
+            encode_rm(0x81, true, ext, false, dst, 4);
+            imm32(src->val);
+        }
+        return;
+    }
+
+    if (src->kind == OP_REG) {
+        encode_rm(ext * 8 + 0x01, true, src->reg, false, dst, 0);
+        return;
+    }
+
+    encode_rm(ext * 8 + 0x03, true, dst->reg, false, src, 0);
+}
+
+static void encode_mov(Insn *insn) {
+    Operand *dst = &insn->dst;
+    Operand *src = &insn->src;
+
+    if (dst->kind == OP_REG && src->kind == OP_IMM) {
+        if (is_imm32(src->val)) {
+            encode_rm(0xc7, true, 0, false, dst, 4);
+            imm32(src->val);
+        } else {
+            byte(0x48 | (dst->reg >> 3));
+            byte(0xb8 + (dst->reg & 7));
+            imm64(src->val);
+        }
+        return;
+    }
+
+    if (dst->kind == OP_MEM && src->kind == OP_IMM) {
+        if (dst->size == 1) {
+            encode_rm(0xc6, false, 0, false, dst, 1);
+            byte(src->val);
+        } else {
+            encode_rm(0xc7, true, 0, false, dst, 4);
+            imm32(src->val);
+        }
+        return;
+    }
+
+    if (src->kind == OP_REG) {
+        if (src->size == 1)
+            encode_rm(0x88, false, src->reg, true, dst, 0);
+        else
+            encode_rm(0x89, true, src->reg, false, dst, 0);
+        return;
+    }
+
+    if (dst->kind == OP_REG && src->kind == OP_MEM) {
+        encode_rm(0x8b, true, dst->reg, false, src, 0);
+        return;
+    }
+
+    error("internal error: cannot encode mov");
+}
+
+static void encode(Insn *insn) {
+    Operand *dst = &insn->dst;
+    Operand *src = &insn->src;
+
+    switch (insn->kind) {
+    case I_LABEL:
+        hashmap_put2(&labels, dst->sym, strlen(dst->sym),
+                     (void *)(text->len + 1));
+        return;
+    case I_PUSH:
+        if (dst->kind == OP_IMM) {
+            if (is_imm8(dst->val)) {
+                byte(0x6a);
+                byte(dst->val);
+            } else {
+                byte(0x68);
+                imm32(dst->val);
+            }
+            return;
+        }
+        if (dst->reg >= R8)
+            byte(0x41);
+        byte(0x50 + (dst->reg & 7));
+        return;
+    case I_POP:
+        if (dst->reg >= R8)
+            byte(0x41);
+        byte(0x58 + (dst->reg & 7));
+        return;
+    case I_MOV:
+        encode_mov(insn);
+        return;
+    case I_MOVSX:
+        encode_rm(0x0fbe, true, dst->reg, false, src, 0);
+        return;
+    case I_MOVZX:
+        encode_rm(0x0fb6, true, dst->reg, false, src, 0);
+        return;
+    case I_LEA:
+        encode_rm(0x8d, true, dst->reg, false, src, 0);
+        return;
+    case I_ADD:
+        encode_alu(insn, 0);
+        return;
+    case I_SUB:
+        encode_alu(insn, 5);
+        return;
+    case I_CMP:
+        encode_alu(insn, 7);
+        return;
+    case I_IMUL:
+        if (src->kind == OP_NONE) {
+            encode_rm(0xf7, true, 5, false, dst, 0);
+        } else if (src->kind == OP_IMM && is_imm8(src->val)) {
+            encode_rm(0x6b, true, dst->reg, false, dst, 1);
+            byte(src->val);
+        } else if (src->kind == OP_IMM) {
+            encode_rm(0x69, true, dst->reg, false, dst, 4);
+            imm32(src->val);
+        } else {
+            encode_rm(0x0faf, true, dst->reg, false, src, 0);
+        }
+        return;
+    case I_SHL:
+        encode_rm(0xc1, true, 4, false, dst, 1);
+        byte(src->val);
+        return;
+    case I_SAR:
+        encode_rm(0xc1, true, 7, false, dst, 1);
+        byte(src->val);
+        return;
+    case I_SHR:
+        encode_rm(0xc1, true, 5, false, dst, 1);
+        byte(src->val);
+        return;
+    case I_CQO:
+        byte(0x48);
+        byte(0x99);
+        return;
+    case I_IDIV:
+        encode_rm(0xf7, true, 7, false, dst, 0);
+        return;
+    case I_NEG:
+        encode_rm(0xf7, true, 3, false, dst, 0);
+        return;
+    case I_SETCC:
+        encode_rm(0x0f90 + insn->cc, false, 0, false, dst, 0);
+        return;
+    case I_JMP:
+        byte(0xe9);
+        rel32(dst->sym, R_X86_64_PLT32);
+        return;
+    case I_JCC:
+        byte(0x0f);
+        byte(0x80 + insn->cc);
+        rel32(dst->sym, R_X86_64_PLT32);
+        return;
+    case I_CALL:
+        byte(0xe8);
+        rel32(dst->sym, R_X86_64_PLT32);
+        return;
+    case I_RET:
+        byte(0xc3);
+        return;
+    case I_MOVDQU:
+        encode_movdqu(insn);
+        return;
+    case I_PADDB:
+        encode_packed(insn, 0xfc);
+        return;
+    case I_PADDQ:
+        encode_packed(insn, 0xd4);
+        return;
+    case I_PSUBB:
+        encode_packed(insn, 0xf8);
+        return;
+    case I_PSUBQ:
+        encode_packed(insn, 0xfb);
+        return;
+    case I_VZEROUPPER:
+        byte(0xc5);
+        byte(0xf8);
+        byte(0x77);
+        return;
+    }
+    unreachable();
+}
+
+static void resolve_fixups(void) {
+    for (Fixup *fx = fixups; fx; fx = fx->next) {
+        long pos = (long)hashmap_get2(&labels, fx->label, strlen(fx->label));
+        if (!pos)
+            error("internal error: undefined label %s", fx->label);
+
+        long rel = (pos - 1) - (fx->offset + 4);
+        for (int i = 0; i < 4; i++)
+            text->data[fx->offset + i] = (rel >> (i * 8)) & 0xff;
+    }
+}
+
+typedef struct {
+    Obj **fns;
+    FuncCode *codes;
+} EncodeJob;
+
+// Encode one function into its own buffer
+static void encode_function(void *arg, int i, Arena *arena) {
+    EncodeJob *job = arg;
+    Obj *fn = job->fns[i];
+    FuncCode *code = &job->codes[i];
+    out_init(&code->text, -1);
+    out_init(&code->relocs, -1);
+
+    fc = code;
+    text = &code->text;
+    scratch = arena;
+    fixups = NULL;
+    Timer t = timer_start();
+
+    for (Insn *insn = codegen(fn, arena); insn; insn = insn->next)
+        encode(insn);
+
+    resolve_fixups();
+    hashmap_free(&labels);
+    timer_stop(&t, "function", fn->name);
+}
+
+// Assemble the whole program into sections, symbols and relocations
+ObjFile *assemble(Obj *prog) {
+    ObjFile *obj = arena_alloc(&tu->code_arena, sizeof(ObjFile));
+    obj->syms_tail = &obj->syms;
+    obj->relocs_tail = &obj->relocs;
+    out_init(&obj->text, -1);
+    out_init(&obj->data, -1);
+
+    for (Obj *var = prog; var; var = var->next) {
+        if (var->is_function)
+            continue;
+
+        Symbol *sym = get_symbol(obj, var->name);
+        sym->section = SEC_DATA;
+        sym->offset = obj->data.len;
+        sym->size = var->ty->size;
+
+        if (var->init_data) {
+            out_mem(&obj->data, var->init_data, var->ty->size);
+        } else {
+            for (int i = 0; i < var->ty->size; i++)
+                out_char(&obj->data, 0);
+        }
+    }
+
+    EncodeJob job;
+    int n;
+    job.fns = get_functions(prog, &n);
+    job.codes = calloc(n, sizeof(FuncCode));
+    parallel_for(n, encode_function, &job, &tu->insn_arena);
+
+    for (int i = 0; i < n; i++) {
+        FuncCode *code = &job.codes[i];
+        Symbol *sym = get_symbol(obj, job.fns[i]->name);
+        sym->section = SEC_TEXT;
+        sym->is_function = true;
+        sym->offset = obj->text.len;
+        sym->size = code->text.len;
+        out_mem(&obj->text, code->text.data, code->text.len);
+
+        FuncReloc *frel = (FuncReloc *)code->relocs.data;
+        int nrels = code->relocs.len / sizeof(FuncReloc);
+        for (int j = 0; j < nrels; j++) {
+            Reloc *rel = arena_alloc(&tu->code_arena, sizeof(Reloc));
+            rel->offset = sym->offset + frel[j].offset;
+            rel->sym = get_symbol(obj, frel[j].name);
+            rel->type = frel[j].type;
+            rel->addend = frel[j].addend;
+            *obj->relocs_tail = rel;
+            obj->relocs_tail = &rel->next;
+        }
+
+        out_free(&code->text);
+        out_free(&code->relocs);
+    }
+    free(job.codes);
+    return obj;
+}
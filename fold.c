@@ -0,0 +1,269 @@
+#include "mcc.h"
+
+// Constant folding and algebraic simplification of the AST. Subtrees
+// whose operands are constants are replaced by their value, identities
+// such as x+0 and x*1 are removed, and "if" and "for" statements with
+// constant conditions are reduced to the code that can actually run.
+//
+// Nodes are rewritten in place, so that the parents and the "next" links
+// of statements don't have to be updated.
+
+static bool is_num(Node *node, long val) {
+    return node->kind == ND_NUM && node->val == val;
+}
+
+// Returns true if evaluating `node` has no side effects
+static bool is_pure(Node *node) {
+    switch (node->kind) {
+    case ND_NUM:
+    case ND_VAR:
+        return true;
+    case ND_NEG:
+    case ND_ADDR:
+    case ND_DEREF:
+        return is_pure(node->lhs);
+    case ND_ADD:
+    case ND_SUB:
+    case ND_MUL:
+    case ND_DIV:
+    case ND_EQ:
+    case ND_NE:
+    case ND_LT:
+    case ND_LE:
+        return is_pure(node->lhs) && is_pure(node->rhs);
+    }
+    return false;
+}
+
+// Returns true if `a` and `b` are the same pure expression and thus
+// always have the same value
+static bool is_same(Node *a, Node *b) {
+    if (a->kind != b->kind)
+        return false;
+
+    switch (a->kind) {
+    case ND_NUM:
+        return a->val == b->val;
+    case ND_VAR:
+        return a->var == b->var;
+    case ND_NEG:
+    case ND_ADDR:
+    case ND_DEREF:
+        return is_same(a->lhs, b->lhs);
+    case ND_ADD:
+    case ND_SUB:
+    case ND_MUL:
+    case ND_DIV:
+    case ND_EQ:
+    case ND_NE:
+    case ND_LT:
+    case ND_LE:
+        return is_same(a->lhs, b->lhs) && is_same(a->rhs, b->rhs);
+    }
+    return false;
+}
+
+// Replace `node` by one of its operands. The operand keeps its own type:
+// a char or an array stays what it is, and their values don't change.
+static void replace(Node *node, Node *with) {
+    Node *next = node->next;
+    *node = *with;
+    node->next = next;
+}
+
+static void set_num(Node *node, long val) {
+    node->kind = ND_NUM;
+    node->val = val;
+    node->lhs = node->rhs = NULL;
+}
+
+// Evaluate a binary operator on constants. Returns false if the result
+// is not defined, as for division by zero.
+static bool eval_binary(NodeKind kind, long x, long y, long *val) {
+    switch (kind) {
+    case ND_ADD:
+        *val = (unsigned long)x + y;
+        return true;
+    case ND_SUB:
+        *val = (unsigned long)x - y;
+        return true;
+    case ND_MUL:
+        *val = (unsigned long)x * y;
+        return true;
+    case ND_DIV:
+        if (y == 0 || (x == LONG_MIN && y == -1))
+            return false;
+        *val = x / y;
+        return true;
+    case ND_EQ:
+        *val = x == y;
+        return true;
+    case ND_NE:
+        *val = x != y;
+        return true;
+    case ND_LT:
+        *val = x < y;
+        return true;
+    case ND_LE:
+        *val = x <= y;
+        return true;
+    }
+    return false;
+}
+
+static void fold_expr(Node *node);
+
+static void fold_binary(Node *node) {
+    fold_expr(node->lhs);
+    fold_expr(node->rhs);
+    Node *lhs = node->lhs;
+    Node *rhs = node->rhs;
+
+    long val;
+    if (lhs->kind == ND_NUM && rhs->kind == ND_NUM &&
+        eval_binary(node->kind, lhs->val, rhs->val, &val)) {
+        set_num(node, val);
+        return;
+    }
+
+    switch (node->kind) {
+    case ND_ADD:
+        if (is_num(rhs, 0)) {
+            replace(node, lhs);
+            return;
+        }
+        if (is_num(lhs, 0)) {
+            replace(node, rhs);
+            return;
+        }
+
+        // (x + c1) + c2 => x + (c1 + c2), which pointer arithmetic such
+        // as p+1+1 produces
+        if (rhs->kind == ND_NUM &&
+            (lhs->kind == ND_ADD || lhs->kind == ND_SUB) &&
+            lhs->rhs->kind == ND_NUM) {
+            long c = lhs->kind == ND_ADD ? lhs->rhs->val : -lhs->rhs->val;
+            rhs->val = (unsigned long)c + rhs->val;
+            node->lhs = lhs->lhs;
+            if (rhs->val == 0)
+                replace(node, node->lhs);
+        }
+        return;
+    case ND_SUB:
+        if (is_num(rhs, 0)) {
+            replace(node, lhs);
+            return;
+        }
+        if (is_pure(lhs) && is_same(lhs, rhs) && is_integer(node->ty)) {
+            set_num(node, 0);
+            return;
+        }
+        return;
+    case ND_MUL:
+        if (is_num(rhs, 1)) {
+            replace(node, lhs);
+            return;
+        }
+        if (is_num(lhs, 1)) {
+            replace(node, rhs);
+            return;
+        }
+        if ((is_num(rhs, 0) && is_pure(lhs)) ||
+            (is_num(lhs, 0) && is_pure(rhs))) {
+            set_num(node, 0);
+            return;
+        }
+        return;
+    case ND_DIV:
+        if (is_num(rhs, 1))
+            replace(node, lhs);
+        return;
+    }
+}
+
+static void fold_expr(Node *node) {
+    switch (node->kind) {
+    case ND_NUM:
+    case ND_VAR:
+        return;
+    case ND_NEG:
+        fold_expr(node->lhs);
+        if (node->lhs->kind == ND_NUM)
+            set_num(node, -(unsigned long)node->lhs->val);
+        return;
+    case ND_ADDR:
+    case ND_DEREF:
+        fold_expr(node->lhs);
+        return;
+    case ND_ASSIGN:
+        fold_expr(node->lhs);
+        fold_expr(node->rhs);
+        return;
+    case ND_FUNCALL:
+        for (Node *arg = node->args; arg; arg = arg->next)
+            fold_expr(arg);
+        return;
+    }
+
+    fold_binary(node);
+}
+
+static void fold_stmt(Node *node) {
+    switch (node->kind) {
+    case ND_IF:
+        fold_expr(node->cond);
+        fold_stmt(node->then);
+        if (node->els)
+            fold_stmt(node->els);
+
+        if (node->cond->kind == ND_NUM) {
+            Node *taken = node->cond->val ? node->then : node->els;
+            if (taken) {
+                replace(node, taken);
+            } else {
+                node->kind = ND_BLOCK;
+                node->body = NULL;
+            }
+        }
+        return;
+    case ND_FOR:
+        if (node->init)
+            fold_stmt(node->init);
+        if (node->cond)
+            fold_expr(node->cond);
+        if (node->inc)
+            fold_expr(node->inc);
+        fold_stmt(node->then);
+
+        if (node->cond && node->cond->kind == ND_NUM) {
+            if (node->cond->val) {
+                // An infinite loop, which needs no test
+                node->cond = NULL;
+            } else {
+                // The body never runs, but the initializer does
+                Node *init = node->init;
+                node->kind = ND_BLOCK;
+                node->body = init;
+                if (init)
+                    init->next = NULL;
+            }
+        }
+        return;
+    case ND_BLOCK:
+        for (Node *n = node->body; n; n = n->next)
+            fold_stmt(n);
+        return;
+    case ND_RETURN:
+    case ND_EXPR_STMT:
+        fold_expr(node->lhs);
+        return;
+    }
+
+    error_tok(node->tok, "invalid statement");
+}
+
+void fold(Obj *prog) {
+    for (Obj *fn = prog; fn; fn = fn->next)
+        if (fn->is_function)
+            fold_stmt(fn->body);
+}
@@ -0,0 +1,164 @@
+#include "mcc.h"
+
+// An open-addressing hash table with linear probing.
+//
+// A map is used in one of two ways: keyed by string contents
+// (hashmap_get2/hashmap_put2), or keyed by interned string pointers
+// (hashmap_get/hashmap_put/hashmap_delete), in which case keys are
+// hashed and compared as pointers. A single map must not mix the two.
+
+#define INIT_SIZE 16
+#define HIGH_WATERMARK 70
+#define LOW_WATERMARK 50
+#define TOMBSTONE ((void *)-1)
+
+static uint64_t fnv_hash(char *s, int len) {
+    uint64_t hash = 0xcbf29ce484222325;
+    for (int i = 0; i < len; i++) {
+        hash *= 0x100000001b3;
+        hash ^= (unsigned char)s[i];
+    }
+    return hash;
+}
+
+static uint64_t ptr_hash(char *key) {
+    uint64_t x = (uintptr_t)key;
+    x ^= x >> 33;
+    x *= 0xff51afd7ed558ccd;
+    x ^= x >> 33;
+    return x;
+}
+
+static uint64_t entry_hash(HashMap *map, HashEntry *ent) {
+    return map->by_ptr ? ptr_hash(ent->key) : fnv_hash(ent->key, ent->keylen);
+}
+
+// Make room for new entries, dropping tombstones on the way
+static void rehash(HashMap *map) {
+    int nkeys = 0;
+    for (int i = 0; i < map->capacity; i++)
+        if (map->buckets[i].key && map->buckets[i].key != TOMBSTONE)
+            nkeys++;
+
+    int cap = map->capacity;
+    while ((nkeys * 100) / cap >= LOW_WATERMARK)
+        cap = cap * 2;
+    assert(cap > 0);
+
+    HashMap map2 = {.by_ptr = map->by_ptr};
+    map2.buckets = calloc(cap, sizeof(HashEntry));
+    map2.capacity = cap;
+
+    for (int i = 0; i < map->capacity; i++) {
+        HashEntry *ent = &map->buckets[i];
+        if (!ent->key || ent->key == TOMBSTONE)
+            continue;
+
+        uint64_t hash = entry_hash(map, ent);
+        for (int j = 0; j < cap; j++) {
+            HashEntry *ent2 = &map2.buckets[(hash + j) % cap];
+            if (!ent2->key) {
+                *ent2 = *ent;
+                map2.used++;
+                break;
+            }
+        }
+    }
+
+    assert(map2.used == nkeys);
+    free(map->buckets);
+    *map = map2;
+}
+
+static bool match(HashMap *map, HashEntry *ent, char *key, int keylen) {
+    if (!ent->key || ent->key == TOMBSTONE)
+        return false;
+    if (map->by_ptr)
+        return ent->key == key;
+    return ent->keylen == keylen && !memcmp(ent->key, key, keylen);
+}
+
+static HashEntry *get_entry(HashMap *map, char *key, int keylen,
+                            uint64_t hash) {
+    if (!map->buckets)
+        return NULL;
+
+    for (int i = 0; i < map->capacity; i++) {
+        HashEntry *ent = &map->buckets[(hash + i) % map->capacity];
+        if (match(map, ent, key, keylen))
+            return ent;
+        if (!ent->key)
+            return NULL;
+    }
+    unreachable();
+}
+
+static HashEntry *get_or_insert_entry(HashMap *map, char *key, int keylen,
+                                      uint64_t hash) {
+    if (!map->buckets) {
+        map->buckets = calloc(INIT_SIZE, sizeof(HashEntry));
+        map->capacity = INIT_SIZE;
+    } else if ((map->used * 100) / map->capacity >= HIGH_WATERMARK) {
+        rehash(map);
+    }
+
+    HashEntry *ent = get_entry(map, key, keylen, hash);
+    if (ent)
+        return ent;
+
+    for (int i = 0; i < map->capacity; i++) {
+        HashEntry *ent = &map->buckets[(hash + i) % map->capacity];
+
+        if (ent->key == TOMBSTONE) {
+            ent->key = key;
+            ent->keylen = keylen;
+            return ent;
+        }
+
+        if (!ent->key) {
+            ent->key = key;
+            ent->keylen = keylen;
+            map->used++;
+            return ent;
+        }
+    }
+    unreachable();
+}
+
+void *hashmap_get(HashMap *map, char *key) {
+    assert(map->by_ptr);
+    HashEntry *ent = get_entry(map, key, 0, ptr_hash(key));
+    return ent ? ent->val : NULL;
+}
+
+void *hashmap_get2(HashMap *map, char *key, int keylen) {
+    assert(!map->by_ptr);
+    HashEntry *ent = get_entry(map, key, keylen, fnv_hash(key, keylen));
+    return ent ? ent->val : NULL;
+}
+
+void hashmap_put(HashMap *map, char *key, void *val) {
+    assert(map->by_ptr);
+    HashEntry *ent = get_or_insert_entry(map, key, 0, ptr_hash(key));
+    ent->val = val;
+}
+
+void hashmap_put2(HashMap *map, char *key, int keylen, void *val) {
+    assert(!map->by_ptr);
+    HashEntry *ent =
+        get_or_insert_entry(map, key, keylen, fnv_hash(key, keylen));
+    ent->val = val;
+}
+
+void hashmap_delete(HashMap *map, char *key) {
+    assert(map->by_ptr);
+    HashEntry *ent = get_entry(map, key, 0, ptr_hash(key));
+    if (ent)
+        ent->key = TOMBSTONE;
+}
+
+void hashmap_free(HashMap *map) {
+    free(map->buckets);
+    map->buckets = NULL;
+    map->capacity = map->used = 0;
+}
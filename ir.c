@@ -0,0 +1,650 @@
+#include "mcc.h"
+
+// Three-address intermediate representation. Each function is lowered
+// from its AST into a control-flow graph of basic blocks. Instructions
+// compute values into virtual registers, each of which is assigned once,
+// except for those of promoted locals. A local whose address is never
+// taken can't be reached through a pointer, so it is promoted to a
+// virtual register of its own that each assignment overwrites; other
+// locals stay in memory and are accessed with explicit loads and stores.
+// Every block ends with a jump, a conditional branch or a return.
+
+// State of the function being lowered. Like codegen, lowering runs on
+// several threads at once.
+typedef struct {
+    IrFunc *fn;
+    Arena *arena;
+    BasicBlock *cur;
+    BasicBlock **tail; // Where the next block in layout order goes
+    Loop **loops_tail;
+    BasicBlock *body; // Where self tail calls jump to
+} Lower;
+
+static _Thread_local Lower *lw;
+
+static char *op_names[] = {
+    [IR_IMM] = "imm",   [IR_ADD] = "add",     [IR_SUB] = "sub",
+    [IR_MUL] = "mul",   [IR_DIV] = "div",     [IR_NEG] = "neg",
+    [IR_EQ] = "eq",     [IR_NE] = "ne",       [IR_LT] = "lt",
+    [IR_LE] = "le",     [IR_LVAR] = "lvar",   [IR_GVAR] = "gvar",
+    [IR_MOV] = "mov",   [IR_PARAM] = "param",
+    [IR_LOAD] = "load", [IR_STORE] = "store", [IR_CALL] = "call",
+    [IR_JMP] = "jmp",   [IR_BR] = "br",       [IR_RET] = "ret",
+    [IR_VLOAD] = "vload", [IR_VSTORE] = "vstore", [IR_VADD] = "vadd",
+    [IR_VSUB] = "vsub",
+};
+
+bool is_terminator(IrInsn *insn) {
+    return insn->op == IR_JMP || insn->op == IR_BR || insn->op == IR_RET;
+}
+
+static int new_vreg(void) { return ++lw->fn->num_vregs; }
+
+static BasicBlock *new_block(void) {
+    BasicBlock *bb = arena_alloc(lw->arena, sizeof(BasicBlock));
+    bb->id = lw->fn->num_blocks++;
+    return bb;
+}
+
+// Place `bb` after the last block and make it current
+static void start_block(BasicBlock *bb) {
+    *lw->tail = bb;
+    lw->tail = &bb->next;
+    lw->cur = bb;
+}
+
+static IrInsn *emit(IrOp op, int dst, int a, int b) {
+    // Code after a return or a jump is unreachable, but it still needs a
+    // block to live in
+    if (lw->cur->last && is_terminator(lw->cur->last))
+        start_block(new_block());
+
+    IrInsn *insn = arena_alloc(lw->arena, sizeof(IrInsn));
+    insn->op = op;
+    insn->dst = dst;
+    insn->a = a;
+    insn->b = b;
+
+    BasicBlock *bb = lw->cur;
+    if (bb->last)
+        bb->last->next = insn;
+    else
+        bb->insns = insn;
+    bb->last = insn;
+    return insn;
+}
+
+static void emit_jmp(BasicBlock *dest) { emit(IR_JMP, 0, 0, 0)->then = dest; }
+
+static void emit_br(int cond, BasicBlock *then, BasicBlock *els) {
+    IrInsn *br = emit(IR_BR, 0, cond, 0);
+    br->then = then;
+    br->els = els;
+}
+
+static int emit_imm(long val) {
+    int v = new_vreg();
+    emit(IR_IMM, v, 0, 0)->imm = val;
+    return v;
+}
+
+static int emit_binary(IrOp op, int a, int b) {
+    int v = new_vreg();
+    emit(op, v, a, b);
+    return v;
+}
+
+// Loops are rotated: the condition is tested once before the first
+// iteration and then at the bottom, so that an iteration takes a single
+// branch. The preheader is where code hoisted out of the loop goes.
+//
+// Start a loop that is entered if `cond` is true, or always if it is 0,
+// and start its body.
+static Loop *begin_loop(int cond) {
+    Loop *loop = arena_alloc(lw->arena, sizeof(Loop));
+    loop->preheader = new_block();
+    loop->header = new_block();
+    loop->exit = new_block();
+
+    if (cond)
+        emit_br(cond, loop->preheader, loop->exit);
+    else
+        emit_jmp(loop->preheader);
+    start_block(loop->preheader);
+    emit_jmp(loop->header);
+    start_block(loop->header);
+    return loop;
+}
+
+// End the body of `loop`, which repeats while `cond` is true
+static void end_loop(Loop *loop, int cond) {
+    if (cond)
+        emit_br(cond, loop->header, loop->exit);
+    else
+        emit_jmp(loop->header);
+    loop->latch = lw->cur;
+    start_block(loop->exit);
+
+    // Inner loops are finished first and thus come first in the list
+    *lw->loops_tail = loop;
+    lw->loops_tail = &loop->next;
+}
+
+bool is_promoted(Obj *var) {
+    return var->is_local && !var->is_addr_taken && var->ty->kind != TY_ARRAY;
+}
+
+// Assign `val` to the promoted local `var`
+static void assign_var(Obj *var, int val) {
+    emit(IR_MOV, var->vreg, val, 0)->size = var->ty->size;
+}
+
+static int lower_expr(Node *node);
+
+static int lower_addr(Node *node) {
+    switch (node->kind) {
+    case ND_VAR: {
+        int v = new_vreg();
+        emit(node->var->is_local ? IR_LVAR : IR_GVAR, v, 0, 0)->var =
+            node->var;
+        return v;
+    }
+    case ND_DEREF:
+        return lower_expr(node->lhs);
+    }
+
+    error_tok(node->tok, "not an lvalue");
+}
+
+// Load a value of type `ty` from `addr`. An array is not loaded; its
+// value is its address. See load() in codegen.c.
+static int lower_load(Type *ty, int addr) {
+    if (ty->kind == TY_ARRAY)
+        return addr;
+
+    int v = new_vreg();
+    emit(IR_LOAD, v, addr, 0)->size = ty->size;
+    return v;
+}
+
+static IrOp binary_op(Node *node) {
+    switch (node->kind) {
+    case ND_ADD:
+        return IR_ADD;
+    case ND_SUB:
+        return IR_SUB;
+    case ND_MUL:
+        return IR_MUL;
+    case ND_DIV:
+        return IR_DIV;
+    case ND_EQ:
+        return IR_EQ;
+    case ND_NE:
+        return IR_NE;
+    case ND_LT:
+        return IR_LT;
+    case ND_LE:
+        return IR_LE;
+    }
+    error_tok(node->tok, "invalid expression");
+}
+
+// Returns the virtual register holding the value of `node`
+static int lower_expr(Node *node) {
+    switch (node->kind) {
+    case ND_NUM: {
+        int v = new_vreg();
+        emit(IR_IMM, v, 0, 0)->imm = node->val;
+        return v;
+    }
+    case ND_NEG: {
+        int a = lower_expr(node->lhs);
+        int v = new_vreg();
+        emit(IR_NEG, v, a, 0);
+        return v;
+    }
+    case ND_VAR: {
+        if (!node->var->vreg)
+            return lower_load(node->ty, lower_addr(node));
+
+        // Read a copy, which an assignment later in the expression
+        // doesn't change. propagate_copies() removes the copies that
+        // aren't needed.
+        int v = new_vreg();
+        emit(IR_MOV, v, node->var->vreg, 0);
+        return v;
+    }
+    case ND_DEREF:
+        return lower_load(node->ty, lower_expr(node->lhs));
+    case ND_ADDR:
+        return lower_addr(node->lhs);
+    case ND_ASSIGN: {
+        if (node->lhs->kind == ND_VAR && node->lhs->var->vreg) {
+            int val = lower_expr(node->rhs);
+            assign_var(node->lhs->var, val);
+            return val;
+        }
+
+        int addr = lower_addr(node->lhs);
+        int val = lower_expr(node->rhs);
+        emit(IR_STORE, 0, addr, val)->size = node->ty->size;
+        return val;
+    }
+    case ND_FUNCALL: {
+        int nargs = 0;
+        for (Node *arg = node->args; arg; arg = arg->next)
+            nargs++;
+
+        int *args = arena_alloc(lw->arena, sizeof(int) * nargs);
+        int i = 0;
+        for (Node *arg = node->args; arg; arg = arg->next)
+            args[i++] = lower_expr(arg);
+
+        int v = new_vreg();
+        IrInsn *insn = emit(IR_CALL, v, 0, 0);
+        insn->funcname = node->funcname;
+        insn->args = args;
+        insn->nargs = nargs;
+        return v;
+    }
+    }
+
+    // The right-hand side is evaluated first unless order.c says
+    // otherwise, as in the stack machine
+    int a, b;
+    if (node->lhs_first) {
+        a = lower_expr(node->lhs);
+        b = lower_expr(node->rhs);
+    } else {
+        b = lower_expr(node->rhs);
+        a = lower_expr(node->lhs);
+    }
+    int v = new_vreg();
+    emit(binary_op(node), v, a, b);
+    return v;
+}
+
+//
+// Vectorized loops; see vector.c
+//
+
+static int lower_vector_expr(Node *node, int size) {
+    if (node->kind == ND_ADD || node->kind == ND_SUB) {
+        int b = lower_vector_expr(node->rhs, size);
+        int a = lower_vector_expr(node->lhs, size);
+        int v = emit_binary(node->kind == ND_ADD ? IR_VADD : IR_VSUB, a, b);
+        lw->cur->last->size = size;
+        return v;
+    }
+
+    int v = new_vreg();
+    emit(IR_VLOAD, v, lower_expr(node->lhs), 0)->size = size;
+    return v;
+}
+
+// Returns whether a whole vector of iterations is left: i <= n - lanes
+// for "i < n", or i <= n - (lanes - 1) for "i <= n"
+static int lower_vector_cond(VecLoop *vl) {
+    int n = lower_expr(vl->bound);
+    int k = emit_imm(vl->cmp == ND_LT ? vl->lanes : vl->lanes - 1);
+    int limit = emit_binary(IR_SUB, n, k);
+    return emit_binary(IR_LE, lower_expr(vl->iv), limit);
+}
+
+// Skip to `scalar` unless the vector at `x` can be written after the
+// vector at `y` has been read: if x - y is 0 or less, the load is never
+// behind a store, and if it is at least the size of a vector, no store
+// reaches a load of the same or a later iteration.
+static void lower_alias_check(Node *x, Node *y, BasicBlock *scalar) {
+    BasicBlock *far = new_block();
+    BasicBlock *ok = new_block();
+
+    int d = emit_binary(IR_SUB, lower_expr(x->lhs), lower_expr(y->lhs));
+    emit_br(emit_binary(IR_LE, d, emit_imm(0)), ok, far);
+    start_block(far);
+    emit_br(emit_binary(IR_LE, emit_imm(vector_size()), d), ok, scalar);
+    start_block(ok);
+}
+
+// Check the destination `dst` against each load in `node`
+static void lower_alias_checks(Node *dst, Node *node, BasicBlock *scalar) {
+    if (node->kind == ND_ADD || node->kind == ND_SUB) {
+        lower_alias_checks(dst, node->lhs, scalar);
+        lower_alias_checks(dst, node->rhs, scalar);
+    } else if (may_overlap(dst, node)) {
+        lower_alias_check(dst, node, scalar);
+    }
+}
+
+static void lower_vector_loop(VecLoop *vl) {
+    Node *dst = vl->store->lhs;
+    BasicBlock *scalar = new_block();
+    lower_alias_checks(dst, vl->store->rhs, scalar);
+
+    Loop *loop = begin_loop(lower_vector_cond(vl));
+    int v = lower_vector_expr(vl->store->rhs, vl->elem_size);
+    emit(IR_VSTORE, 0, lower_expr(dst->lhs), v)->size = vl->elem_size;
+
+    // i = i + lanes. The induction variable is a promoted local.
+    int i = emit_binary(IR_ADD, lower_expr(vl->iv), emit_imm(vl->lanes));
+    assign_var(vl->iv->var, i);
+    end_loop(loop, lower_vector_cond(vl));
+
+    emit_jmp(scalar);
+    start_block(scalar);
+}
+
+// Lower "return fn(...)" in fn itself as a jump back to the start of the
+// body. All arguments are evaluated before any parameter is assigned.
+static void lower_self_tail_call(Node *node) {
+    int args[6]; // Arguments of tail calls fit in registers
+    int n = 0;
+    for (Node *arg = node->args; arg; arg = arg->next)
+        args[n++] = lower_expr(arg);
+
+    n = 0;
+    for (Obj *var = lw->fn->fn->params; var; var = var->next)
+        assign_var(var, args[n++]);
+    emit_jmp(lw->body);
+}
+
+static void lower_stmt(Node *node) {
+    switch (node->kind) {
+    case ND_IF: {
+        BasicBlock *then = new_block();
+        BasicBlock *els = node->els ? new_block() : NULL;
+        BasicBlock *join = new_block();
+
+        emit_br(lower_expr(node->cond), then, els ? els : join);
+
+        start_block(then);
+        lower_stmt(node->then);
+        emit_jmp(join);
+        if (els) {
+            start_block(els);
+            lower_stmt(node->els);
+            emit_jmp(join);
+        }
+        start_block(join);
+        return;
+    }
+    case ND_FOR: {
+        if (node->init)
+            lower_stmt(node->init);
+
+        // A vector loop goes first and leaves the rest of the
+        // iterations to the loop itself
+        VecLoop vl;
+        if (is_vector_loop(node, lw->fn->fn, &vl))
+            lower_vector_loop(&vl);
+
+        Loop *loop = begin_loop(node->cond ? lower_expr(node->cond) : 0);
+        lower_stmt(node->then);
+        if (node->inc)
+            lower_expr(node->inc);
+        end_loop(loop, node->cond ? lower_expr(node->cond) : 0);
+        return;
+    }
+    case ND_BLOCK:
+        for (Node *n = node->body; n; n = n->next)
+            lower_stmt(n);
+        return;
+    case ND_RETURN:
+        if (is_self_tail_call(node->lhs, lw->fn->fn)) {
+            lower_self_tail_call(node->lhs);
+            return;
+        }
+        if (is_tail_call(node->lhs, lw->fn->fn)) {
+            int v = lower_expr(node->lhs);
+            lw->cur->last->is_tail = true;
+            emit(IR_RET, 0, v, 0);
+            return;
+        }
+        emit(IR_RET, 0, lower_expr(node->lhs), 0);
+        return;
+    case ND_EXPR_STMT:
+        lower_expr(node->lhs);
+        return;
+    }
+
+    error_tok(node->tok, "invalid statement");
+}
+
+// Lower the body of `fn` into a CFG allocated in `arena`. The first
+// block is the entry.
+IrFunc *lower_function(Obj *fn, Arena *arena) {
+    IrFunc *ir = arena_alloc(arena, sizeof(IrFunc));
+    ir->fn = fn;
+
+    Lower ctx = {ir, arena};
+    ctx.tail = &ir->blocks;
+    ctx.loops_tail = &ir->loops;
+    lw = &ctx;
+
+    // Promoted locals take the first virtual registers
+    for (Obj *var = fn->locals; var; var = var->next)
+        var->vreg = is_promoted(var) ? new_vreg() : 0;
+    ir->num_vars = ir->num_vregs;
+
+    start_block(new_block());
+    int i = 0;
+    for (Obj *var = fn->params; var; var = var->next, i++) {
+        if (var->vreg) {
+            IrInsn *insn = emit(IR_PARAM, var->vreg, 0, 0);
+            insn->imm = i;
+            insn->size = var->ty->size;
+        }
+    }
+    if (has_self_tail_call(fn->body, fn)) {
+        ctx.body = new_block();
+        emit_jmp(ctx.body);
+        start_block(ctx.body);
+    }
+    lower_stmt(fn->body);
+
+    // Falling off the end returns whatever is in rax, as before
+    if (!lw->cur->last || !is_terminator(lw->cur->last))
+        emit(IR_RET, 0, 0, 0);
+
+    lw = NULL;
+    return ir;
+}
+
+typedef struct {
+    IrFunc *ir;
+    int *copy_of; // Promoted local that a copy was made of
+    int *copy_bb; // Block of the copy
+    int *seen;    // Assignments to the local before the copy
+    int *count;   // Assignments to each promoted local so far
+    int *uses;
+} CopyProp;
+
+// If `v` is a copy of a promoted local that still holds the same value,
+// returns the local instead
+static int subst(CopyProp *cp, BasicBlock *bb, int v) {
+    int var = cp->copy_of[v];
+    if (var && cp->copy_bb[v] == bb->id && cp->seen[v] == cp->count[var])
+        return var;
+    return v;
+}
+
+// Returns true if `insn` may write its result into a promoted local
+// instead of a temporary: codegen computes "dst = a op b" as "dst = a;
+// dst op= b", which must not overwrite b.
+static bool can_retarget(IrInsn *insn, int var) {
+    return (insn->op == IR_ADD || insn->op == IR_SUB || insn->op == IR_NEG) &&
+           insn->b != var;
+}
+
+// Use promoted locals directly instead of the copies that lowering
+// reads them into, where the local isn't assigned between the copy and
+// its use, and compute values assigned to a promoted local right into
+// its register, so that "i = i + 1" takes a single instruction.
+static void propagate_copies(IrFunc *ir, Arena *arena) {
+    int n = ir->num_vregs + 1;
+    CopyProp cp = {ir};
+    cp.copy_of = arena_alloc(arena, sizeof(int) * n);
+    cp.copy_bb = arena_alloc(arena, sizeof(int) * n);
+    cp.seen = arena_alloc(arena, sizeof(int) * n);
+    cp.count = arena_alloc(arena, sizeof(int) * n);
+    cp.uses = arena_alloc(arena, sizeof(int) * n);
+
+    for (BasicBlock *bb = ir->blocks; bb; bb = bb->next) {
+        for (IrInsn *insn = bb->insns; insn; insn = insn->next) {
+            insn->a = subst(&cp, bb, insn->a);
+            insn->b = subst(&cp, bb, insn->b);
+            for (int i = 0; i < insn->nargs; i++)
+                insn->args[i] = subst(&cp, bb, insn->args[i]);
+
+            if (insn->dst && insn->dst <= ir->num_vars)
+                cp.count[insn->dst]++;
+            if (insn->op == IR_MOV && insn->dst > ir->num_vars &&
+                insn->a <= ir->num_vars) {
+                cp.copy_of[insn->dst] = insn->a;
+                cp.copy_bb[insn->dst] = bb->id;
+                cp.seen[insn->dst] = cp.count[insn->a];
+            }
+
+            cp.uses[insn->a]++;
+            cp.uses[insn->b]++;
+            for (int i = 0; i < insn->nargs; i++)
+                cp.uses[insn->args[i]]++;
+        }
+    }
+
+    for (BasicBlock *bb = ir->blocks; bb; bb = bb->next) {
+        IrInsn head = {bb->insns};
+        IrInsn *prev = &head;
+        for (IrInsn *insn = bb->insns; insn; insn = insn->next) {
+            // A copy that is no longer used
+            bool dead = insn->op == IR_MOV && insn->dst > ir->num_vars &&
+                        !cp.uses[insn->dst];
+
+            // "t = a op b; var = t" becomes "var = a op b"
+            if (insn->op == IR_MOV && insn->dst <= ir->num_vars &&
+                insn->a > ir->num_vars && insn->size == 8 &&
+                prev != &head && prev->dst == insn->a &&
+                cp.uses[insn->a] == 1 && can_retarget(prev, insn->dst)) {
+                prev->dst = insn->dst;
+                dead = true;
+            }
+
+            if (dead)
+                prev->next = insn->next;
+            else
+                prev = insn;
+        }
+        bb->insns = head.next;
+        bb->last = prev == &head ? NULL : prev;
+    }
+}
+
+// Lower `fn` and optimize its IR
+IrFunc *build_ir(Obj *fn, Arena *arena) {
+    IrFunc *ir = lower_function(fn, arena);
+    propagate_copies(ir, arena);
+    hoist_invariants(ir, arena);
+    return ir;
+}
+
+static void print_vreg(OutBuf *buf, int v) {
+    out_char(buf, 'v');
+    out_int(buf, v);
+}
+
+static void print_block_ref(OutBuf *buf, BasicBlock *bb) {
+    out_str(buf, "bb");
+    out_int(buf, bb->id);
+}
+
+void print_ir_insn(OutBuf *buf, IrInsn *insn) {
+    out_str(buf, "    ");
+    if (insn->dst) {
+        print_vreg(buf, insn->dst);
+        out_str(buf, " = ");
+    }
+    out_str(buf, insn->is_tail ? "tailcall" : op_names[insn->op]);
+    bool is_byte_mov =
+        (insn->op == IR_MOV || insn->op == IR_PARAM) && insn->size == 1;
+    if (insn->op == IR_LOAD || insn->op == IR_STORE ||
+        insn->op >= IR_VLOAD || is_byte_mov) {
+        out_char(buf, '.');
+        out_int(buf, insn->size);
+    }
+
+    switch (insn->op) {
+    case IR_IMM:
+    case IR_PARAM:
+        out_char(buf, ' ');
+        out_int(buf, insn->imm);
+        break;
+    case IR_LVAR:
+    case IR_GVAR:
+        out_char(buf, ' ');
+        out_str(buf, insn->var->name);
+        break;
+    case IR_CALL:
+        out_char(buf, ' ');
+        out_str(buf, insn->funcname);
+        out_char(buf, '(');
+        for (int i = 0; i < insn->nargs; i++) {
+            if (i > 0)
+                out_str(buf, ", ");
+            print_vreg(buf, insn->args[i]);
+        }
+        out_char(buf, ')');
+        break;
+    case IR_JMP:
+        out_char(buf, ' ');
+        print_block_ref(buf, insn->then);
+        break;
+    case IR_BR:
+        out_char(buf, ' ');
+        print_vreg(buf, insn->a);
+        out_str(buf, ", ");
+        print_block_ref(buf, insn->then);
+        out_str(buf, ", ");
+        print_block_ref(buf, insn->els);
+        break;
+    default:
+        if (insn->a) {
+            out_char(buf, ' ');
+            print_vreg(buf, insn->a);
+        }
+        if (insn->b) {
+            out_str(buf, ", ");
+            print_vreg(buf, insn->b);
+        }
+    }
+    out_char(buf, '\n');
+}
+
+void print_ir(OutBuf *buf, IrFunc *ir) {
+    out_str(buf, ir->fn->name);
+    out_str(buf, ":\n");
+    for (BasicBlock *bb = ir->blocks; bb; bb = bb->next) {
+        print_block_ref(buf, bb);
+        out_str(buf, ":\n");
+        for (IrInsn *insn = bb->insns; insn; insn = insn->next)
+            print_ir_insn(buf, insn);
+    }
+}
+
+// Write the IR of every function (-emit-ir)
+void emit_ir(Obj *prog, FILE *out) {
+    OutBuf buf;
+    fflush(out);
+    out_init(&buf, fileno(out));
+
+    int n;
+    Obj **fns = get_functions(prog, &n);
+    for (int i = 0; i < n; i++) {
+        if (i > 0)
+            out_char(&buf, '\n');
+        print_ir(&buf, build_ir(fns[i], &tu->insn_arena));
+        arena_reset(&tu->insn_arena);
+    }
+
+    out_flush(&buf);
+    out_free(&buf);
+}
@@ -0,0 +1,90 @@
+#include "mcc.h"
+
+// In-memory execution of a program (--run). The program is assembled
+// with the built-in encoder, copied into an anonymous mapping together
+// with its data, relocated, and then main() is called directly.
+//
+// The mapping is laid out as follows:
+//
+//   .text | stubs for external functions | (page boundary) .data
+//
+// Symbols that are not defined by the program are looked up with dlsym.
+// They may be anywhere in the address space, so calls to them go through
+// a stub that jumps via a 64-bit absolute address.
+
+// jmp [rip + 0] followed by the target address
+#define STUB_SIZE 14
+
+static long align_to(long n, long align) {
+    return (n + align - 1) / align * align;
+}
+
+static void write_stub(char *p, void *target) {
+    p[0] = 0xff;
+    p[1] = 0x25;
+    memset(p + 2, 0, 4);
+    memcpy(p + 6, &target, 8);
+}
+
+// Compile the program into executable memory and return the address
+// of its main function
+void *jit_compile(Obj *prog) {
+    ObjFile *obj = assemble(prog);
+    long pagesize = sysconf(_SC_PAGESIZE);
+
+    int nstubs = 0;
+    for (Symbol *sym = obj->syms; sym; sym = sym->next)
+        if (sym->section == SEC_UNDEF)
+            sym->index = nstubs++;
+
+    long stubs_off = align_to(obj->text.len, 16);
+    long data_off = align_to(stubs_off + nstubs * STUB_SIZE, pagesize);
+    long size = align_to(data_off + obj->data.len, pagesize);
+
+    char *base = mmap(NULL, size, PROT_READ | PROT_WRITE,
+                      MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (base == MAP_FAILED)
+        error("mmap failed: %s", strerror(errno));
+
+    memcpy(base, obj->text.data, obj->text.len);
+    memcpy(base + data_off, obj->data.data, obj->data.len);
+
+    // Resolve symbols to their addresses in the mapping
+    char *main_addr = NULL;
+    for (Symbol *sym = obj->syms; sym; sym = sym->next) {
+        char *addr;
+        if (sym->section == SEC_TEXT) {
+            addr = base + sym->offset;
+        } else if (sym->section == SEC_DATA) {
+            addr = base + data_off + sym->offset;
+        } else {
+            void *target = dlsym(RTLD_DEFAULT, sym->name);
+            if (!target)
+                error("undefined symbol: %s", sym->name);
+            addr = base + stubs_off + sym->index * STUB_SIZE;
+            write_stub(addr, target);
+        }
+        sym->offset = addr - base;
+
+        if (sym->section == SEC_TEXT && !strcmp(sym->name, "main"))
+            main_addr = addr;
+    }
+
+    if (!main_addr)
+        error("undefined symbol: main");
+
+    // Every relocation is PC-relative within the mapping
+    for (Reloc *rel = obj->relocs; rel; rel = rel->next) {
+        long val = rel->sym->offset + rel->addend - rel->offset;
+        int32_t val32 = val;
+        memcpy(base + rel->offset, &val32, 4);
+    }
+
+    if (mprotect(base, data_off, PROT_READ | PROT_EXEC))
+        error("mprotect failed: %s", strerror(errno));
+
+    out_free(&obj->text);
+    out_free(&obj->data);
+    hashmap_free(&obj->symtab);
+    return main_addr;
+}
@@ -0,0 +1,150 @@
+#include "mcc.h"
+
+// Loop-invariant code motion. An instruction in a loop whose operands
+// are all defined outside of it computes the same value on every
+// iteration, so it is moved to the loop's preheader and runs only once.
+//
+// The preheader runs even if the loop would never have reached the
+// instruction, so only instructions that can neither trap nor have side
+// effects are moved. Loads are not moved; the locals that nothing but
+// the function itself can change are promoted to virtual registers
+// anyway. Nor are assignments to promoted locals, whose old value the
+// loop may still read.
+//
+// Constants and variable addresses are cheaper to recompute than to
+// keep in a register for the whole loop, so they are moved only along
+// with an instruction that uses them.
+
+typedef struct {
+    IrFunc *ir;
+    IrInsn **defs;   // Definition of each temporary
+    Loop **def_loop; // Last loop found to define each virtual register
+    bool *hoist;     // Virtual registers whose definitions move
+} Licm;
+
+static bool is_invariant(Licm *lc, Loop *loop, bool *inv, int v) {
+    return !v || inv[v] || lc->def_loop[v] != loop;
+}
+
+// Returns true if `insn` can be executed speculatively and yields the
+// same value wherever it is executed, given the same operands
+static bool is_movable(Licm *lc, IrInsn *insn) {
+    if (insn->dst <= lc->ir->num_vars)
+        return false;
+
+    switch (insn->op) {
+    case IR_IMM:
+    case IR_LVAR:
+    case IR_GVAR:
+    case IR_ADD:
+    case IR_SUB:
+    case IR_MUL:
+    case IR_NEG:
+    case IR_EQ:
+    case IR_NE:
+    case IR_LT:
+    case IR_LE:
+        return true;
+    case IR_DIV: {
+        // Only division by a constant is sure not to trap
+        IrInsn *b = lc->defs[insn->b];
+        return b && b->op == IR_IMM && b->imm != 0 && b->imm != -1;
+    }
+    }
+    return false;
+}
+
+static bool is_cheap(IrInsn *insn) {
+    return insn->op == IR_IMM || insn->op == IR_LVAR || insn->op == IR_GVAR;
+}
+
+// Mark `v` and the operands it is computed from in the loop for hoisting
+static void mark(Licm *lc, Loop *loop, int v) {
+    if (!v || lc->hoist[v] || lc->def_loop[v] != loop)
+        return;
+    lc->hoist[v] = true;
+    mark(lc, loop, lc->defs[v]->a);
+    mark(lc, loop, lc->defs[v]->b);
+}
+
+static void hoist_loop(Licm *lc, Loop *loop, bool *inv) {
+    BasicBlock *end = loop->latch->next;
+
+    for (BasicBlock *bb = loop->header; bb != end; bb = bb->next)
+        for (IrInsn *insn = bb->insns; insn; insn = insn->next)
+            lc->def_loop[insn->dst] = loop;
+
+    // Operands come before their uses in layout order, except for
+    // promoted locals, which are never invariant if the loop assigns
+    // them. So one pass finds every invariant value.
+    bool found = false;
+    for (BasicBlock *bb = loop->header; bb != end; bb = bb->next) {
+        for (IrInsn *insn = bb->insns; insn; insn = insn->next) {
+            if (!insn->dst || !is_movable(lc, insn) ||
+                !is_invariant(lc, loop, inv, insn->a) ||
+                !is_invariant(lc, loop, inv, insn->b))
+                continue;
+            inv[insn->dst] = true;
+            if (!is_cheap(insn)) {
+                mark(lc, loop, insn->dst);
+                found = true;
+            }
+        }
+    }
+    if (!found)
+        return;
+
+    // Move the marked instructions in their original order to the end
+    // of the preheader, before its jump to the header
+    BasicBlock *ph = loop->preheader;
+    IrInsn head = {ph->insns};
+    IrInsn *at = &head;
+    while (at->next != ph->last)
+        at = at->next;
+
+    for (BasicBlock *bb = loop->header; bb != end; bb = bb->next) {
+        IrInsn *prev = NULL;
+        for (IrInsn *insn = bb->insns, *next; insn; insn = next) {
+            next = insn->next;
+            if (!insn->dst || !lc->hoist[insn->dst]) {
+                prev = insn;
+                continue;
+            }
+
+            if (prev)
+                prev->next = next;
+            else
+                bb->insns = next;
+
+            insn->next = at->next;
+            at->next = insn;
+            at = insn;
+            lc->def_loop[insn->dst] = NULL;
+            lc->hoist[insn->dst] = false;
+        }
+    }
+    ph->insns = head.next;
+}
+
+void hoist_invariants(IrFunc *ir, Arena *arena) {
+    if (!ir->loops)
+        return;
+
+    int n = ir->num_vregs + 1;
+    Licm lc = {ir};
+    lc.defs = arena_alloc(arena, sizeof(IrInsn *) * n);
+    lc.def_loop = arena_alloc(arena, sizeof(Loop *) * n);
+    lc.hoist = arena_alloc(arena, n);
+
+    for (BasicBlock *bb = ir->blocks; bb; bb = bb->next)
+        for (IrInsn *insn = bb->insns; insn; insn = insn->next)
+            if (insn->dst > ir->num_vars)
+                lc.defs[insn->dst] = insn;
+
+    // Inner loops come first, so code hoisted out of an inner loop can
+    // then be hoisted out of the enclosing one
+    for (Loop *loop = ir->loops; loop; loop = loop->next) {
+        bool *inv = arena_alloc(arena, n);
+        hoist_loop(&lc, loop, inv);
+    }
+}
@@ -1,15 +1,35 @@
 #include "mcc.h"
 
 static char *opt_o;
+static bool opt_c;
+static bool opt_run;
+static bool opt_emit_ir;
+static bool opt_fmem_stats;
+static bool opt_fstats;
+static bool opt_ftime_report;
+static char *opt_trace;
 
-static char *input_path;
+static char **input_paths;
+static int num_inputs;
+
+// With --run, arguments after the input file are passed to main()
+static int run_argc;
+static char **run_argv;
 
 void usage(int status) {
-    fprintf(stderr, "mcc [ -o <path> ] <file>\n");
+    fprintf(stderr,
+            "mcc [ -c | -emit-ir ] [ -o <path> ] [ -j <threads> ]\n"
+            "    [ -fno-regalloc ] [ -funroll-loops[=<n>] ]\n"
+            "    [ -fno-vectorize ] [ -mavx2 ] [ -fno-peephole ]\n"
+            "    [ -fmem-stats ] [ -fstats ] [ -ftime-report ]\n"
+            "    [ --trace=<path> ] <file>...\n"
+            "mcc --run [ options ] <file> [ <args>... ]\n");
     exit(status);
 }
 
 void parse_args(int argc, char **argv) {
+    input_paths = calloc(argc, sizeof(char *));
+
     for (int i = 1; i < argc; i++) {
         if (!strcmp(argv[i], "--help"))
             usage(0);
@@ -21,6 +41,80 @@ void parse_args(int argc, char **argv) {
             continue;
         }
 
+        if (!strcmp(argv[i], "-j")) {
+            if (!argv[++i])
+                usage(1);
+            num_threads = atoi(argv[i]);
+            continue;
+        }
+
+        if (!strcmp(argv[i], "-c")) {
+            opt_c = true;
+            continue;
+        }
+
+        if (!strcmp(argv[i], "--run")) {
+            opt_run = true;
+            continue;
+        }
+
+        if (!strcmp(argv[i], "-fmem-stats")) {
+            opt_fmem_stats = true;
+            continue;
+        }
+
+        if (!strcmp(argv[i], "-fstats")) {
+            opt_fstats = true;
+            continue;
+        }
+
+        if (!strcmp(argv[i], "-emit-ir")) {
+            opt_emit_ir = true;
+            continue;
+        }
+
+        if (!strcmp(argv[i], "-fno-regalloc")) {
+            opt_regalloc = false;
+            continue;
+        }
+
+        if (!strcmp(argv[i], "-fno-vectorize")) {
+            opt_vectorize = false;
+            continue;
+        }
+
+        if (!strcmp(argv[i], "-fno-peephole")) {
+            opt_peephole = false;
+            continue;
+        }
+
+        if (!strcmp(argv[i], "-mavx2")) {
+            opt_avx2 = true;
+            continue;
+        }
+
+        if (!strcmp(argv[i], "-funroll-loops")) {
+            opt_unroll = 4;
+            continue;
+        }
+
+        if (!strncmp(argv[i], "-funroll-loops=", 15)) {
+            opt_unroll = atoi(argv[i] + 15);
+            if (opt_unroll < 1)
+                error("invalid unroll factor: %s", argv[i] + 15);
+            continue;
+        }
+
+        if (!strcmp(argv[i], "-ftime-report")) {
+            opt_ftime_report = true;
+            continue;
+        }
+
+        if (!strncmp(argv[i], "--trace=", 8)) {
+            opt_trace = argv[i] + 8;
+            continue;
+        }
+
         if (!strncmp(argv[i], "-o", 2)) {
             opt_o = argv[i] + 2;
             continue;
@@ -29,11 +123,30 @@ void parse_args(int argc, char **argv) {
         if (argv[i][0] == '-' && argv[i][1] != '\0')
             error("unknown argument: %s", argv[i]);
 
-        input_path = argv[i];
+        input_paths[num_inputs++] = argv[i];
+
+        if (opt_run) {
+            run_argc = argc - i;
+            run_argv = argv + i;
+            break;
+        }
     }
 
-    if (!input_path)
+    if (num_inputs == 0)
         error("no input files");
+    if (num_inputs > 1 && opt_o)
+        error("cannot specify -o with multiple files");
+}
+
+// Replace the extension of the last path component of `path`, e.g.
+// "dir/foo.c" -> "foo.o"
+char *replace_extn(char *path, char *extn) {
+    char *filename = strrchr(path, '/');
+    filename = filename ? filename + 1 : path;
+
+    char *dot = strrchr(filename, '.');
+    int len = dot ? dot - filename : strlen(filename);
+    return format("%.*s%s", len, filename, extn);
 }
 
 FILE *open_file(char *path) {
@@ -46,13 +159,115 @@ FILE *open_file(char *path) {
     return out;
 }
 
+// Returns the output path for `input`, or NULL for stdout
+char *output_path(char *input) {
+    if (opt_o)
+        return opt_o;
+    if (!strcmp(input, "-"))
+        return NULL;
+
+    // Like cc, write "foo.o" for "foo.c" unless told otherwise
+    if (opt_emit_ir)
+        return num_inputs > 1 ? replace_extn(input, ".ir") : NULL;
+    if (opt_c)
+        return replace_extn(input, ".o");
+
+    // Assembly goes to stdout unless there are several files
+    if (num_inputs > 1)
+        return replace_extn(input, ".s");
+    return NULL;
+}
+
+Obj *parse_file(char *input) {
+    Timer t = timer_start();
+    Token *tok = tokenize_file(input);
+    timer_stop(&t, "phase", "tokenize");
+
+    t = timer_start();
+    Obj *prog = parse(tok);
+    timer_stop(&t, "phase", "parse");
+
+    t = timer_start();
+    fold(prog);
+    timer_stop(&t, "phase", "fold");
+
+    t = timer_start();
+    order_operands(prog);
+    timer_stop(&t, "phase", "order");
+
+    if (opt_unroll) {
+        t = timer_start();
+        unroll(prog);
+        timer_stop(&t, "phase", "unroll");
+    }
+    return prog;
+}
+
+// Compile one file. Several files may be compiled at once, each on its
+// own thread.
+void compile_file(char *input) {
+    tu = new_unit(input);
+    Obj *prog = parse_file(input);
+
+    Timer t = timer_start();
+    char *path = output_path(input);
+    FILE *out = open_file(path);
+    if (opt_emit_ir)
+        emit_ir(prog, out);
+    else if (opt_c)
+        emit_obj(prog, out);
+    else
+        emit_asm(prog, out);
+    if (out != stdout)
+        fclose(out);
+    timer_stop(&t, "phase", "codegen");
+
+    if (opt_ftime_report)
+        print_time_report(stderr);
+    free_unit(tu);
+    tu = NULL;
+}
+
+void compile_task(void *arg, int i, Arena *arena) {
+    compile_file(input_paths[i]);
+}
+
+// Print statistics that cover all files
+void finish(void) {
+    if (opt_fmem_stats)
+        print_mem_stats(stderr);
+    if (opt_fstats)
+        print_peephole_stats(stderr);
+    if (opt_trace)
+        write_trace(opt_trace);
+}
+
 int main(int argc, char **argv) {
     parse_args(argc, argv);
+    timing_enabled = opt_ftime_report || opt_trace;
 
-    Token *tok = tokenize_file(input_path);
-    Obj *prog = parse(tok);
+    if (opt_run) {
+        tu = new_unit(input_paths[0]);
+        Obj *prog = parse_file(input_paths[0]);
+
+        Timer t = timer_start();
+        int (*main_fn)(int, char **) = jit_compile(prog);
+        timer_stop(&t, "phase", "codegen");
 
-    FILE *out = open_file(opt_o);
-    codegen(prog, out);
+        if (opt_ftime_report)
+            print_time_report(stderr);
+        free_unit(tu);
+        finish();
+        return main_fn(run_argc, run_argv);
+    }
+
+    // With a single file, threads are used to compile its functions in
+    // parallel instead
+    if (num_inputs == 1)
+        compile_file(input_paths[0]);
+    else
+        parallel_for(num_inputs, compile_task, NULL, NULL);
+
+    finish();
     return 0;
-}
\ No newline at end of file
+}
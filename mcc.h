@@ -1,16 +1,37 @@
 #define _POSIX_C_SOURCE 200809L
+#define _GNU_SOURCE
 
 #include <assert.h>
 #include <ctype.h>
+#include <dlfcn.h>
+#include <elf.h>
 #include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <pthread.h>
 #include <stdarg.h>
+#include <stdatomic.h>
 #include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <sys/mman.h>
+#include <sys/resource.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
 
 typedef struct Type Type;
 typedef struct Node Node;
+typedef struct Obj Obj;
+typedef struct Scope Scope;
+typedef struct Insn Insn;
+typedef struct IrInsn IrInsn;
+typedef struct BasicBlock BasicBlock;
+
+#define unreachable() error("internal error at %s:%d", __FILE__, __LINE__)
 
 //
 // strings.c
@@ -18,6 +39,111 @@ typedef struct Node Node;
 
 char *format(char *fmt, ...);
 
+//
+// arena.c
+//
+
+typedef struct ArenaBlock ArenaBlock;
+
+// Bump-pointer allocator. Each compiler phase allocates from its own
+// arena so that everything it created can be released at once.
+typedef struct {
+    char *name;
+    ArenaBlock *blocks;
+    char *ptr;
+    char *end;
+
+    // Statistics for -fmem-stats
+    size_t bytes;
+    size_t objects;
+    size_t reserved;
+} Arena;
+
+void *arena_alloc(Arena *arena, size_t size);
+char *arena_strndup(Arena *arena, char *p, size_t len);
+void arena_reset(Arena *arena);
+void arena_free(Arena *arena);
+
+//
+// hashmap.c
+//
+
+typedef struct {
+    char *key;
+    int keylen;
+    void *val;
+} HashEntry;
+
+typedef struct {
+    HashEntry *buckets;
+    int capacity;
+    int used;
+    bool by_ptr; // Keys are interned strings compared by address
+} HashMap;
+
+void *hashmap_get(HashMap *map, char *key);
+void *hashmap_get2(HashMap *map, char *key, int keylen);
+void hashmap_put(HashMap *map, char *key, void *val);
+void hashmap_put2(HashMap *map, char *key, int keylen, void *val);
+void hashmap_delete(HashMap *map, char *key);
+void hashmap_free(HashMap *map);
+
+//
+// unit.c
+//
+
+// Everything that belongs to one translation unit. Several files can be
+// compiled at once in one process, so per-file state is never kept in
+// globals; `tu` points to the unit being compiled by the current thread.
+typedef struct {
+    char *filename;
+    char *input;         // Contents of the file
+    size_t input_mapped; // Length of the mapping if `input` is mmap'ed
+
+    HashMap idents; // Interned identifiers
+
+    // Parser state
+    Obj *globals;
+    Obj *locals;
+    Scope *scope;
+    HashMap symtab;
+    int unique_id;
+
+    // Statistics for -ftime-report
+    int num_tokens;
+    int num_nodes;
+    int num_objs;
+
+    Arena token_arena;
+    Arena type_arena;
+    Arena node_arena;
+    Arena scope_arena;
+    Arena insn_arena;
+    Arena code_arena;
+} TransUnit;
+
+extern _Thread_local TransUnit *tu;
+
+TransUnit *new_unit(char *filename);
+void free_unit(TransUnit *unit);
+void print_mem_stats(FILE *out);
+
+//
+// timing.c
+//
+
+typedef struct {
+    long wall;
+    long cpu;
+} Timer;
+
+extern bool timing_enabled;
+
+Timer timer_start(void);
+void timer_stop(Timer *t, char *cat, char *name);
+void print_time_report(FILE *out);
+void write_trace(char *path);
+
 //
 // tokenize.c
 //
@@ -31,24 +157,44 @@ typedef enum {
     TK_EOF,     // End-of-file markers
 } TokenKind;
 
+// Keyword and punctuator IDs. A single-character punctuator uses its
+// character code as its ID, so the parser can write e.g. `tok->id == ';'`.
+// Other tokens have ID 0.
+typedef enum {
+    PU_EQ = 256, // ==
+    PU_NE,       // !=
+    PU_LE,       // <=
+    PU_GE,       // >=
+    KW_RETURN,
+    KW_IF,
+    KW_ELSE,
+    KW_FOR,
+    KW_WHILE,
+    KW_INT,
+    KW_SIZEOF,
+    KW_CHAR,
+} TokenId;
+
 // Token type
 typedef struct Token Token;
 struct Token {
     TokenKind kind; // Token kind
+    int id;         // If kind is TK_KEYWORD or TK_PUNCT, its TokenId
     Token *next;    // Next token
-    int val;        // If kind is TK_NUM, its value
+    long val;       // If kind is TK_NUM, its value
     char *loc;      // Token location
     int len;        // Token length
     Type *ty;       // Used if TK_STR
     char *str;      // String literal contents including terminating '\0'
+    char *ident;    // If kind is TK_IDENT or TK_KEYWORD, its interned name
 };
 
 void error(char *fmt, ...);
 void error_at(char *loc, char *fmt, ...);
 void error_tok(Token *tok, char *fmt, ...);
-bool equal(Token *tok, char *str);
-Token *skip(Token *tok, char *str);
-bool consume(Token **rest, Token *tok, char *str);
+Token *skip(Token *tok, int id);
+bool consume(Token **rest, Token *tok, int id);
+char *intern(char *s, int len);
 Token *tokenize_file(char *filename);
 
 //
@@ -56,7 +202,6 @@ Token *tokenize_file(char *filename);
 //
 
 // Variable or function
-typedef struct Obj Obj;
 struct Obj {
     Obj *next;
     char *name;    // Variable name
@@ -65,6 +210,8 @@ struct Obj {
 
     // Local variable
     int offset;
+    bool is_addr_taken; // Operand of "&" somewhere
+    int vreg;           // Virtual register of a promoted local in IR
 
     // Global variable or function
     bool is_function;
@@ -110,8 +257,9 @@ struct Node {
     Type *ty;      // Type
     Token *tok;    // Representative token
 
-    Node *lhs; // Left-hand side
-    Node *rhs; // Right-hand side
+    Node *lhs;      // Left-hand side
+    Node *rhs;      // Right-hand side
+    bool lhs_first; // Evaluate lhs before rhs; see order.c
 
     // "if" or "for" statement
     Node *cond;
@@ -128,13 +276,65 @@ struct Node {
     Node *args;
 
     Obj *var; // Used if kind == ND_VAR
-    int val;  // Used if kind == ND_NUM
+    long val; // Used if kind == ND_NUM
 };
 
-extern Obj *locals;
-
+Node *new_node(NodeKind kind, Token *tok);
+Node *new_binary(NodeKind kind, Node *lhs, Node *rhs, Token *tok);
+Node *new_num(long val, Token *tok);
 Obj *parse(Token *tok);
 
+//
+// fold.c
+//
+
+void fold(Obj *prog);
+
+//
+// order.c
+//
+
+void order_operands(Obj *prog);
+
+//
+// tailcall.c
+//
+
+bool is_tail_call(Node *node, Obj *fn);
+bool is_self_tail_call(Node *node, Obj *fn);
+bool has_self_tail_call(Node *node, Obj *fn);
+
+//
+// unroll.c
+//
+
+extern int opt_unroll;
+
+bool is_private_local(Node *loop, Obj *var, Obj *fn);
+bool is_counted_loop(Node *node, Obj *fn, long *step);
+void unroll(Obj *prog);
+
+//
+// vector.c
+//
+
+// A loop "for (...; i < n; i = i + 1) a[i] = ..." to vectorize
+typedef struct {
+    Node *iv;      // The induction variable i
+    Node *bound;   // n
+    NodeKind cmp;  // ND_LT or ND_LE
+    Node *store;   // The assignment in the body
+    int elem_size; // Size of array elements, 1 or 8
+    int lanes;     // Elements per vector
+} VecLoop;
+
+extern bool opt_vectorize;
+extern bool opt_avx2;
+
+int vector_size(void);
+bool is_vector_loop(Node *node, Obj *fn, VecLoop *vl);
+bool may_overlap(Node *x, Node *y);
+
 //
 // type.c
 //
@@ -182,8 +382,318 @@ Type *func_type(Type *return_ty);
 Type *array_of(Type *base, int size);
 void add_type(Node *node);
 
+//
+// output.c
+//
+
+typedef struct {
+    char *data;
+    size_t len;
+    size_t cap;
+    int fd; // Destination file descriptor, or -1 for in-memory buffers
+} OutBuf;
+
+void out_init(OutBuf *buf, int fd);
+void out_mem(OutBuf *buf, char *s, size_t len);
+void out_str(OutBuf *buf, char *s);
+void out_char(OutBuf *buf, char c);
+void out_int(OutBuf *buf, long val);
+void out_flush(OutBuf *buf);
+void out_free(OutBuf *buf);
+
+//
+// parallel.c
+//
+
+extern int num_threads;
+
+void parallel_for(int n, void (*fn)(void *arg, int i, Arena *arena),
+                  void *arg, Arena *arena);
+
+//
+// asm.c
+//
+
+// x86-64 general-purpose registers, numbered as in instruction encodings
+typedef enum {
+    RAX,
+    RCX,
+    RDX,
+    RBX,
+    RSP,
+    RBP,
+    RSI,
+    RDI,
+    R8,
+    R9,
+    R10,
+    R11,
+    R12,
+    R13,
+    R14,
+    R15,
+    RIP, // Only used as the base of RIP-relative memory operands
+} Reg;
+
+// Registers numbered from VREG_BASE are virtual registers, which codegen
+// uses for temporaries and regalloc() replaces with machine registers
+#define VREG_BASE 32
+
+// Condition codes, numbered as in Jcc/SETcc encodings
+typedef enum {
+    CC_E = 0x4,
+    CC_NE = 0x5,
+    CC_L = 0xc,
+    CC_GE = 0xd,
+    CC_LE = 0xe,
+    CC_G = 0xf,
+} CondCode;
+
+typedef enum {
+    OP_NONE,
+    OP_REG,   // Register
+    OP_IMM,   // Immediate
+    OP_MEM,   // [base + index*scale + disp] or sym[rip]
+    OP_LABEL, // Jump or call target
+} OperandKind;
+
+typedef struct {
+    OperandKind kind;
+    int size;  // Operand size in bytes (1, 8, or 16 or 32 for vectors)
+    int reg;   // Register, or base register of a memory operand
+    long val;  // Immediate value or displacement
+    char *sym; // Symbol of a RIP-relative memory operand or a label
+    int index; // Index register of a memory operand if scale is nonzero
+    int scale; // 1, 2, 4 or 8
+} Operand;
+
+typedef enum {
+    I_LABEL, // Label definition
+    I_PUSH,
+    I_POP,
+    I_MOV,
+    I_MOVSX,
+    I_MOVZX,
+    I_LEA,
+    I_ADD,
+    I_SUB,
+    I_IMUL, // dst *= src; without src, rdx:rax = rax * dst
+    I_SHL,
+    I_SAR,
+    I_SHR,
+    I_CQO,
+    I_IDIV,
+    I_NEG,
+    I_CMP,
+    I_SETCC,
+    I_JMP,
+    I_JCC,
+    I_CALL,
+    I_RET,
+    I_MOVDQU, // Vector load or store
+    I_PADDB,
+    I_PADDQ,
+    I_PSUBB,
+    I_PSUBQ,
+    I_VZEROUPPER,
+} InsnKind;
+
+// Machine instruction in Intel operand order
+struct Insn {
+    Insn *next;
+    InsnKind kind;
+    CondCode cc; // For I_SETCC and I_JCC
+    Operand dst;
+    Operand src;
+};
+
+Operand reg(Reg r);
+Operand reg8(Reg r);
+Operand vec(int r, int size);
+Operand imm(long val);
+Operand mem(Reg base, long disp, int size);
+Operand mem_index(Reg base, Reg index, int scale, long disp);
+Operand mem_sym(char *sym);
+Operand label(char *name);
+Insn *new_insn(Arena *arena, InsnKind kind, Operand dst, Operand src);
+bool is_avx(Insn *insn);
+void print_insn(OutBuf *buf, Insn *insn);
+void emit_asm(Obj *prog, FILE *out);
+
+//
+// encode.c
+//
+
+typedef enum {
+    SEC_UNDEF,
+    SEC_TEXT,
+    SEC_DATA,
+} SectionKind;
+
+typedef struct Symbol Symbol;
+struct Symbol {
+    Symbol *next;
+    char *name;
+    SectionKind section; // SEC_UNDEF if defined in another file
+    long offset;
+    long size;
+    bool is_local;
+    bool is_function;
+    int index; // Index in the ELF symbol table
+};
+
+// A 32-bit field in .text that refers to a symbol
+typedef struct Reloc Reloc;
+struct Reloc {
+    Reloc *next;
+    long offset;
+    Symbol *sym;
+    int type; // R_X86_64_PC32 or R_X86_64_PLT32
+    long addend;
+};
+
+// Assembled program
+typedef struct {
+    OutBuf text;
+    OutBuf data;
+    Symbol *syms; // In order of first reference
+    Symbol **syms_tail;
+    HashMap symtab;
+    Reloc *relocs;
+    Reloc **relocs_tail;
+} ObjFile;
+
+Symbol *get_symbol(ObjFile *obj, char *name);
+ObjFile *assemble(Obj *prog);
+
+//
+// elf.c
+//
+
+void emit_obj(Obj *prog, FILE *out);
+
+//
+// jit.c
+//
+
+void *jit_compile(Obj *prog);
+
+//
+// ir.c
+//
+
+typedef enum {
+    IR_IMM,   // dst = imm
+    IR_ADD,   // dst = a + b
+    IR_SUB,   // dst = a - b
+    IR_MUL,   // dst = a * b
+    IR_DIV,   // dst = a / b
+    IR_NEG,   // dst = -a
+    IR_EQ,    // dst = a == b
+    IR_NE,    // dst = a != b
+    IR_LT,    // dst = a < b
+    IR_LE,    // dst = a <= b
+    IR_LVAR,  // dst = address of local variable
+    IR_GVAR,  // dst = address of global variable
+    IR_MOV,   // dst = a, sign-extended from its low byte if `size` is 1
+    IR_PARAM, // dst = parameter number imm
+    IR_LOAD,  // dst = `size` bytes at a
+    IR_STORE, // `size` bytes at a = b
+    IR_CALL,  // dst = funcname(args...)
+    IR_JMP,   // goto then
+    IR_BR,    // if a goto then else goto els
+    IR_RET,   // return a
+    IR_VLOAD,  // dst = vector of `size`-byte elements at a
+    IR_VSTORE, // vector at a = b
+    IR_VADD,   // dst = a + b, lanewise
+    IR_VSUB,   // dst = a - b, lanewise
+} IrOp;
+
+// Three-address instruction. Virtual registers are numbered from 1, so
+// that 0 can stand for none.
+struct IrInsn {
+    IrInsn *next;
+    IrOp op;
+    int dst;
+    int a;
+    int b;
+
+    int size;         // IR_LOAD, IR_STORE, IR_MOV and vector element size
+    long imm;         // IR_IMM and IR_PARAM
+    Obj *var;         // IR_LVAR and IR_GVAR
+    BasicBlock *then; // IR_JMP and IR_BR
+    BasicBlock *els;  // IR_BR
+
+    // IR_CALL
+    char *funcname;
+    int *args;
+    int nargs;
+    bool is_tail; // Leave the frame and jump to funcname; see tailcall.c
+};
+
+// Straight-line code that ends with a terminator (jmp, br or ret)
+struct BasicBlock {
+    BasicBlock *next; // Next block in layout order
+    int id;
+    IrInsn *insns;
+    IrInsn *last;
+};
+
+// A loop from a "for" or "while" statement. Its blocks are contiguous in
+// layout order, from the header to the latch.
+typedef struct Loop Loop;
+struct Loop {
+    Loop *next;
+    BasicBlock *preheader; // Runs once before the first iteration
+    BasicBlock *header;    // First block of the body
+    BasicBlock *latch;     // Ends with the branch back to the header
+    BasicBlock *exit;      // Where the loop goes when it is done
+};
+
+typedef struct {
+    Obj *fn;
+    BasicBlock *blocks; // Layout order; the first block is the entry
+    Loop *loops;        // Inner loops come before outer ones
+    int num_blocks;
+    int num_vregs;
+    int num_vars; // Virtual registers 1 to num_vars hold promoted locals
+} IrFunc;
+
+bool is_terminator(IrInsn *insn);
+bool is_promoted(Obj *var);
+IrFunc *lower_function(Obj *fn, Arena *arena);
+IrFunc *build_ir(Obj *fn, Arena *arena);
+void print_ir_insn(OutBuf *buf, IrInsn *insn);
+void print_ir(OutBuf *buf, IrFunc *ir);
+void emit_ir(Obj *prog, FILE *out);
+
+//
+// loop.c
+//
+
+void hoist_invariants(IrFunc *ir, Arena *arena);
+
 //
 // codegen.c
 //
 
-void codegen(Obj *prog, FILE *out);
+extern bool opt_regalloc;
+
+Obj **get_functions(Obj *prog, int *n);
+CondCode invert_cc(CondCode cc);
+Insn *codegen(Obj *fn, Arena *arena);
+
+//
+// regalloc.c
+//
+
+void regalloc(Insn *insns, int num_vregs, Insn *frame, Arena *arena);
+
+//
+// peephole.c
+//
+
+extern bool opt_peephole;
+
+void peephole(Insn **insns);
+void print_peephole_stats(FILE *out);
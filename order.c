@@ -0,0 +1,98 @@
+#include "mcc.h"
+
+// Evaluation order of binary operators (Sethi and Ullman, 1970). The
+// Ershov number of an expression is the number of registers, or stack
+// slots, that evaluating it needs: 1 for a leaf, and for a binary
+// operator the larger number of its operands, plus one if both are the
+// same. Evaluating the operand that needs more first keeps the total at
+// that number, because its registers are free again by the time the
+// other operand is evaluated.
+//
+// Codegen evaluates the right-hand side first. Where the left-hand side
+// needs more, the operands of a commutative operator are swapped, and
+// other operators are marked to evaluate the left-hand side first. The
+// order is only changed if neither side has side effects, so programs
+// behave the same either way.
+
+static int max(int x, int y) { return x > y ? x : y; }
+
+static bool is_commutative(Node *node) {
+    return node->kind == ND_ADD || node->kind == ND_MUL ||
+           node->kind == ND_EQ || node->kind == ND_NE;
+}
+
+// Returns the Ershov number of `node` and sets *pure to whether it has
+// no side effects
+static int order_expr(Node *node, bool *pure) {
+    switch (node->kind) {
+    case ND_NUM:
+    case ND_VAR:
+        *pure = true;
+        return 1;
+    case ND_NEG:
+    case ND_ADDR:
+    case ND_DEREF:
+        return order_expr(node->lhs, pure);
+    case ND_FUNCALL: {
+        // Each argument is held while the next ones are evaluated
+        int n = 1, i = 0;
+        for (Node *arg = node->args; arg; arg = arg->next, i++) {
+            bool p;
+            n = max(n, order_expr(arg, &p) + i);
+        }
+        *pure = false;
+        return n;
+    }
+    }
+
+    bool lpure, rpure;
+    int l = order_expr(node->lhs, &lpure);
+    int r = order_expr(node->rhs, &rpure);
+    *pure = lpure && rpure && node->kind != ND_ASSIGN;
+
+    if (*pure && l > r) {
+        if (is_commutative(node)) {
+            Node *lhs = node->lhs;
+            node->lhs = node->rhs;
+            node->rhs = lhs;
+        } else {
+            node->lhs_first = true;
+        }
+    }
+    return l == r ? l + 1 : max(l, r);
+}
+
+static void order_stmt(Node *node) {
+    bool pure;
+    switch (node->kind) {
+    case ND_IF:
+        order_expr(node->cond, &pure);
+        order_stmt(node->then);
+        if (node->els)
+            order_stmt(node->els);
+        return;
+    case ND_FOR:
+        if (node->init)
+            order_stmt(node->init);
+        if (node->cond)
+            order_expr(node->cond, &pure);
+        if (node->inc)
+            order_expr(node->inc, &pure);
+        order_stmt(node->then);
+        return;
+    case ND_BLOCK:
+        for (Node *n = node->body; n; n = n->next)
+            order_stmt(n);
+        return;
+    case ND_RETURN:
+    case ND_EXPR_STMT:
+        order_expr(node->lhs, &pure);
+        return;
+    }
+}
+
+void order_operands(Obj *prog) {
+    for (Obj *fn = prog; fn; fn = fn->next)
+        if (fn->is_function)
+            order_stmt(fn->body);
+}
@@ -0,0 +1,93 @@
+#include "mcc.h"
+
+// A growable output buffer. A buffer attached to a file descriptor is
+// flushed with a single write() whenever it fills up; a buffer with
+// fd == -1 just keeps growing and is used to build output in memory.
+
+#define OUTBUF_SIZE (1024 * 1024)
+
+// In-memory buffers start small since there is one for every function
+// when code is generated in parallel
+#define OUTBUF_MEM_SIZE 4096
+
+void out_init(OutBuf *buf, int fd) {
+    buf->fd = fd;
+    buf->len = 0;
+    buf->cap = fd == -1 ? OUTBUF_MEM_SIZE : OUTBUF_SIZE;
+    buf->data = malloc(buf->cap);
+    if (!buf->data)
+        error("out of memory");
+}
+
+void out_flush(OutBuf *buf) {
+    if (buf->fd == -1)
+        return;
+
+    char *p = buf->data;
+    size_t len = buf->len;
+    while (len > 0) {
+        ssize_t n = write(buf->fd, p, len);
+        if (n == -1) {
+            if (errno == EINTR)
+                continue;
+            error("write failed: %s", strerror(errno));
+        }
+        p += n;
+        len -= n;
+    }
+    buf->len = 0;
+}
+
+// Make room for at least `len` more bytes
+static void reserve(OutBuf *buf, size_t len) {
+    if (buf->len + len <= buf->cap)
+        return;
+
+    if (buf->fd != -1) {
+        out_flush(buf);
+        if (len <= buf->cap)
+            return;
+    }
+
+    while (buf->cap < buf->len + len)
+        buf->cap *= 2;
+    buf->data = realloc(buf->data, buf->cap);
+    if (!buf->data)
+        error("out of memory");
+}
+
+void out_mem(OutBuf *buf, char *s, size_t len) {
+    reserve(buf, len);
+    memcpy(buf->data + buf->len, s, len);
+    buf->len += len;
+}
+
+void out_str(OutBuf *buf, char *s) { out_mem(buf, s, strlen(s)); }
+
+void out_char(OutBuf *buf, char c) {
+    reserve(buf, 1);
+    buf->data[buf->len++] = c;
+}
+
+// Append the decimal representation of `val`
+void out_int(OutBuf *buf, long val) {
+    char tmp[24];
+    char *p = tmp + sizeof(tmp);
+
+    // Negate in unsigned arithmetic so that LONG_MIN works
+    unsigned long u = val < 0 ? -(unsigned long)val : val;
+    do {
+        *--p = '0' + u % 10;
+        u /= 10;
+    } while (u);
+
+    if (val < 0)
+        *--p = '-';
+    out_mem(buf, p, tmp + sizeof(tmp) - p);
+}
+
+void out_free(OutBuf *buf) {
+    free(buf->data);
+    buf->data = NULL;
+    buf->len = buf->cap = 0;
+}
@@ -0,0 +1,100 @@
+#include "mcc.h"
+
+// A minimal worker pool. Functions are compiled independently of each
+// other, so their code can be generated on several threads at once.
+// Tasks are handed out in order from a shared counter; callers store
+// each result at its index, which keeps the output deterministic.
+//
+// Several files can be compiled at once, too. A parallel_for() called
+// from within a task runs serially, so that -j bounds the total number
+// of threads.
+
+int num_threads;
+
+// True while this thread is running a task
+static _Thread_local bool in_task;
+
+typedef struct {
+    int n;
+    void (*fn)(void *arg, int i, Arena *arena);
+    void *arg;
+    bool use_arena;
+    TransUnit *tu;
+    atomic_int next;
+} Job;
+
+typedef struct {
+    pthread_t thread;
+    Job *job;
+    Arena arena;
+} Worker;
+
+static void run_tasks(Job *job, Arena *arena) {
+    bool saved = in_task;
+    in_task = true;
+
+    for (;;) {
+        int i = atomic_fetch_add(&job->next, 1);
+        if (i >= job->n)
+            break;
+        job->fn(job->arg, i, arena);
+        if (arena)
+            arena_reset(arena);
+    }
+    in_task = saved;
+}
+
+static void *worker_main(void *arg) {
+    Worker *w = arg;
+    tu = w->job->tu;
+    run_tasks(w->job, w->job->use_arena ? &w->arena : NULL);
+    return NULL;
+}
+
+static int get_num_threads(void) {
+    if (num_threads > 0)
+        return num_threads;
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    return n > 0 ? n : 1;
+}
+
+// Call fn(arg, i, arena) for each i in [0, n). The calling thread takes
+// part and passes `arena`; the other threads pass scratch arenas of their
+// own, whose usage is added to `arena` at the end. Each arena is reset
+// after every call. If `arena` is NULL, tasks get no arena at all.
+// Worker threads run with the caller's translation unit.
+void parallel_for(int n, void (*fn)(void *arg, int i, Arena *arena),
+                  void *arg, Arena *arena) {
+    Job job = {n, fn, arg, arena != NULL, tu};
+
+    int nworkers = in_task ? 0 : get_num_threads() - 1;
+    if (nworkers > n - 1)
+        nworkers = n - 1;
+    if (nworkers < 0)
+        nworkers = 0;
+
+    Worker *workers = calloc(nworkers, sizeof(Worker));
+    for (int i = 0; i < nworkers; i++) {
+        workers[i].job = &job;
+        workers[i].arena.name = arena ? arena->name : NULL;
+        int err = pthread_create(&workers[i].thread, NULL, worker_main,
+                                 &workers[i]);
+        if (err)
+            error("cannot create thread: %s", strerror(err));
+    }
+
+    run_tasks(&job, arena);
+
+    // Fold the workers' arena usage into `arena` for -fmem-stats
+    for (int i = 0; i < nworkers; i++) {
+        pthread_join(workers[i].thread, NULL);
+        Arena *a = &workers[i].arena;
+        if (arena) {
+            arena->bytes += a->bytes;
+            arena->objects += a->objects;
+            arena->reserved += a->reserved;
+        }
+        arena_free(a);
+    }
+    free(workers);
+}
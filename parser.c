@@ -3,22 +3,22 @@
 // Scope for local or global variables
 typedef struct VarScope VarScope;
 struct VarScope {
-    VarScope *next;
+    VarScope *next;   // Next variable declared in the same block
+    VarScope *shadow; // Outer variable hidden by this one
     char *name;
     Obj *var;
 };
 
 // Represents a block scope
-typedef struct Scope Scope;
 struct Scope {
     Scope *next;
     VarScope *vars;
 };
 
-Obj *locals;
-Obj *globals;
-
-Scope *scope = &(Scope){};
+// tu->symtab maps each interned name to its innermost visible variable.
+// Declarations that it hides are chained through VarScope::shadow and
+// become visible again when leave_scope() pops the block that declared
+// it.
 
 Type *declspec(Token **rest, Token *tok);
 Type *declarator(Token **rest, Token *tok, Type *ty);
@@ -37,24 +37,30 @@ Node *unary(Token **rest, Token *tok);
 Node *primary(Token **rest, Token *tok);
 
 void enter_scope() {
-    Scope *sc = calloc(1, sizeof(Scope));
-    sc->next = scope;
-    scope = sc;
+    Scope *sc = arena_alloc(&tu->scope_arena, sizeof(Scope));
+    sc->next = tu->scope;
+    tu->scope = sc;
 }
 
-void leave_scope() { scope = scope->next; }
+void leave_scope() {
+    for (VarScope *sc = tu->scope->vars; sc; sc = sc->next) {
+        if (sc->shadow)
+            hashmap_put(&tu->symtab, sc->name, sc->shadow);
+        else
+            hashmap_delete(&tu->symtab, sc->name);
+    }
+    tu->scope = tu->scope->next;
+}
 
 // Find a variable by name
 Obj *find_var(Token *tok) {
-    for (Scope *sc = scope; sc; sc = sc->next)
-        for (VarScope *sc2 = sc->vars; sc2; sc2 = sc2->next)
-            if (equal(tok, sc2->name))
-                return sc2->var;
-    return NULL;
+    VarScope *sc = hashmap_get(&tu->symtab, tok->ident);
+    return sc ? sc->var : NULL;
 }
 
 Node *new_node(NodeKind kind, Token *tok) {
-    Node *node = calloc(1, sizeof(Node));
+    Node *node = arena_alloc(&tu->node_arena, sizeof(Node));
+    tu->num_nodes++;
     node->kind = kind;
     node->tok = tok;
     return node;
@@ -75,7 +81,7 @@ Node *new_unary(NodeKind kind, Node *expr, Token *tok) {
     return node;
 }
 
-Node *new_num(int val, Token *tok) {
+Node *new_num(long val, Token *tok) {
     Node *node = new_node(ND_NUM, tok);
     node->val = val;
     add_type(node);
@@ -90,16 +96,19 @@ Node *new_var_node(Obj *var, Token *tok) {
 }
 
 VarScope *push_scope(char *name, Obj *var) {
-    VarScope *sc = calloc(1, sizeof(VarScope));
+    VarScope *sc = arena_alloc(&tu->scope_arena, sizeof(VarScope));
     sc->name = name;
     sc->var = var;
-    sc->next = scope->vars;
-    scope->vars = sc;
+    sc->shadow = hashmap_get(&tu->symtab, name);
+    sc->next = tu->scope->vars;
+    tu->scope->vars = sc;
+    hashmap_put(&tu->symtab, name, sc);
     return sc;
 }
 
 Obj *new_var(char *name, Type *ty) {
-    Obj *var = calloc(1, sizeof(Obj));
+    Obj *var = arena_alloc(&tu->node_arena, sizeof(Obj));
+    tu->num_objs++;
     var->name = name;
     var->ty = ty;
     push_scope(name, var);
@@ -109,21 +118,20 @@ Obj *new_var(char *name, Type *ty) {
 Obj *new_lvar(char *name, Type *ty) {
     Obj *var = new_var(name, ty);
     var->is_local = true;
-    var->next = locals;
-    locals = var;
+    var->next = tu->locals;
+    tu->locals = var;
     return var;
 }
 
 Obj *new_gvar(char *name, Type *ty) {
     Obj *var = new_var(name, ty);
-    var->next = globals;
-    globals = var;
+    var->next = tu->globals;
+    tu->globals = var;
     return var;
 }
 
 char *new_unique_name() {
-    static int id = 0;
-    return format(".L..%d", id++);
+    return format(".L..%d", tu->unique_id++);
 }
 
 Obj *new_anon_gvar(Type *ty) { return new_gvar(new_unique_name(), ty); }
@@ -137,7 +145,7 @@ Obj *new_string_literal(char *p, Type *ty) {
 char *get_ident(Token *tok) {
     if (tok->kind != TK_IDENT)
         error_tok(tok, "expected an identifier");
-    return strndup(tok->loc, tok->len);
+    return tok->ident;
 }
 
 int get_number(Token *tok) {
@@ -148,11 +156,11 @@ int get_number(Token *tok) {
 
 // declspec = "char" | "int"
 Type *declspec(Token **rest, Token *tok) {
-    if (equal(tok, "char")) {
+    if (tok->id == KW_CHAR) {
         *rest = tok->next;
         return ty_char;
     }
-    *rest = skip(tok, "int");
+    *rest = skip(tok, KW_INT);
     return ty_int;
 }
 
@@ -161,9 +169,9 @@ Type *func_params(Token **rest, Token *tok, Type *ty) {
     Type head = {};
     Type *cur = &head;
 
-    while (!equal(tok, ")")) {
+    while (tok->id != ')') {
         if (cur != &head)
-            tok = skip(tok, ",");
+            tok = skip(tok, ',');
         Type *basety = declspec(&tok, tok);
         Type *ty = declarator(&tok, tok, basety);
         cur = cur->next = copy_type(ty);
@@ -178,12 +186,12 @@ Type *func_params(Token **rest, Token *tok, Type *ty) {
 //             | "[" num "]" type-suffix
 //             | ε
 Type *type_suffix(Token **rest, Token *tok, Type *ty) {
-    if (equal(tok, "("))
+    if (tok->id == '(')
         return func_params(rest, tok->next, ty);
 
-    if (equal(tok, "[")) {
+    if (tok->id == '[') {
         int sz = get_number(tok->next);
-        tok = skip(tok->next->next, "]");
+        tok = skip(tok->next->next, ']');
         ty = type_suffix(rest, tok, ty);
         return array_of(ty, sz);
     }
@@ -194,7 +202,7 @@ Type *type_suffix(Token **rest, Token *tok, Type *ty) {
 
 // declarator = "*"* ident type-suffix
 Type *declarator(Token **rest, Token *tok, Type *ty) {
-    while (consume(&tok, tok, "*"))
+    while (consume(&tok, tok, '*'))
         ty = pointer_to(ty);
 
     if (tok->kind != TK_IDENT)
@@ -214,14 +222,14 @@ Node *declaration(Token **rest, Token *tok) {
     Node *cur = &head;
     int i = 0;
 
-    while (!equal(tok, ";")) {
+    while (tok->id != ';') {
         if (i++ > 0)
-            tok = skip(tok, ",");
+            tok = skip(tok, ',');
 
         Type *ty = declarator(&tok, tok, basety);
         Obj *var = new_lvar(get_ident(ty->name), ty);
 
-        if (!equal(tok, "="))
+        if (tok->id != '=')
             continue;
 
         Node *lhs = new_var_node(var, ty->name);
@@ -236,7 +244,9 @@ Node *declaration(Token **rest, Token *tok) {
     return node;
 }
 
-bool is_typename(Token *tok) { return equal(tok, "char") || equal(tok, "int"); }
+bool is_typename(Token *tok) {
+    return tok->id == KW_CHAR || tok->id == KW_INT;
+}
 
 // stmt = "return" expr ";"
 //      | "if" "(" expr ")" stmt ("else" stmt)?
@@ -245,50 +255,48 @@ bool is_typename(Token *tok) { return equal(tok, "char") || equal(tok, "int"); }
 //      | "{" compound-stmt
 //      | expr-stmt
 Node *stmt(Token **rest, Token *tok) {
-    if (equal(tok, "return")) {
+    switch (tok->id) {
+    case KW_RETURN: {
         Node *node = new_node(ND_RETURN, tok);
         node->lhs = expr(&tok, tok->next);
-        *rest = skip(tok, ";");
+        *rest = skip(tok, ';');
         return node;
     }
-
-    if (equal(tok, "if")) {
+    case KW_IF: {
         Node *node = new_node(ND_IF, tok);
-        tok = skip(tok->next, "(");
+        tok = skip(tok->next, '(');
         node->cond = expr(&tok, tok);
-        tok = skip(tok, ")");
+        tok = skip(tok, ')');
         node->then = stmt(&tok, tok);
-        if (equal(tok, "else"))
+        if (tok->id == KW_ELSE)
             node->els = stmt(&tok, tok->next);
         *rest = tok;
         return node;
     }
-
-    if (equal(tok, "for")) {
+    case KW_FOR: {
         Node *node = new_node(ND_FOR, tok);
-        tok = skip(tok->next, "(");
+        tok = skip(tok->next, '(');
         node->init = expr_stmt(&tok, tok);
-        if (!equal(tok, ";"))
+        if (tok->id != ';')
             node->cond = expr(&tok, tok);
-        tok = skip(tok, ";");
-        if (!equal(tok, ")"))
+        tok = skip(tok, ';');
+        if (tok->id != ')')
             node->inc = expr(&tok, tok);
-        tok = skip(tok, ")");
+        tok = skip(tok, ')');
         node->then = stmt(rest, tok);
         return node;
     }
-
-    if (equal(tok, "while")) {
+    case KW_WHILE: {
         Node *node = new_node(ND_FOR, tok);
-        tok = skip(tok->next, "(");
+        tok = skip(tok->next, '(');
         node->cond = expr(&tok, tok);
-        tok = skip(tok, ")");
+        tok = skip(tok, ')');
         node->then = stmt(rest, tok);
         return node;
     }
-
-    if (equal(tok, "{"))
+    case '{':
         return compound_stmt(rest, tok->next);
+    }
 
     return expr_stmt(rest, tok);
 }
@@ -300,7 +308,7 @@ Node *compound_stmt(Token **rest, Token *tok) {
 
     enter_scope();
 
-    while (!equal(tok, "}")) {
+    while (tok->id != '}') {
         if (is_typename(tok))
             cur = cur->next = declaration(&tok, tok);
         else
@@ -317,14 +325,14 @@ Node *compound_stmt(Token **rest, Token *tok) {
 
 // expr-stmt = expr? ";"
 Node *expr_stmt(Token **rest, Token *tok) {
-    if (equal(tok, ";")) {
+    if (tok->id == ';') {
         *rest = tok->next;
         return new_node(ND_BLOCK, tok);
     }
 
     Node *node = new_node(ND_EXPR_STMT, tok);
     node->lhs = expr(&tok, tok);
-    *rest = skip(tok, ";");
+    *rest = skip(tok, ';');
     return node;
 }
 
@@ -334,7 +342,7 @@ Node *expr(Token **rest, Token *tok) { return assign(rest, tok); }
 // assign = equality ("=" assign)?
 Node *assign(Token **rest, Token *tok) {
     Node *node = equality(&tok, tok);
-    if (equal(tok, "="))
+    if (tok->id == '=')
         node = new_binary(ND_ASSIGN, node, assign(&tok, tok->next), tok);
     *rest = tok;
     return node;
@@ -345,12 +353,11 @@ Node *equality(Token **rest, Token *tok) {
     Node *node = relational(&tok, tok);
 
     for (;;) {
-        if (equal(tok, "==")) {
+        switch (tok->id) {
+        case PU_EQ:
             node = new_binary(ND_EQ, node, relational(&tok, tok->next), tok);
             continue;
-        }
-
-        if (equal(tok, "!=")) {
+        case PU_NE:
             node = new_binary(ND_NE, node, relational(&tok, tok->next), tok);
             continue;
         }
@@ -365,22 +372,17 @@ Node *relational(Token **rest, Token *tok) {
     Node *node = add(&tok, tok);
 
     for (;;) {
-        if (equal(tok, "<")) {
+        switch (tok->id) {
+        case '<':
             node = new_binary(ND_LT, node, add(&tok, tok->next), tok);
             continue;
-        }
-
-        if (equal(tok, "<=")) {
+        case PU_LE:
             node = new_binary(ND_LE, node, add(&tok, tok->next), tok);
             continue;
-        }
-
-        if (equal(tok, ">")) {
+        case '>':
             node = new_binary(ND_LT, add(&tok, tok->next), node, tok);
             continue;
-        }
-
-        if (equal(tok, ">=")) {
+        case PU_GE:
             node = new_binary(ND_LE, add(&tok, tok->next), node, tok);
             continue;
         }
@@ -437,12 +439,11 @@ Node *add(Token **rest, Token *tok) {
     Node *node = mul(&tok, tok);
 
     for (;;) {
-        if (equal(tok, "+")) {
+        switch (tok->id) {
+        case '+':
             node = new_add(node, mul(&tok, tok->next), tok);
             continue;
-        }
-
-        if (equal(tok, "-")) {
+        case '-':
             node = new_sub(node, mul(&tok, tok->next), tok);
             continue;
         }
@@ -457,12 +458,13 @@ Node *mul(Token **rest, Token *tok) {
     Node *node = unary(&tok, tok);
 
     for (;;) {
-        if (equal(tok, "*")) {
+        switch (tok->id) {
+        case '*':
             node = new_binary(ND_MUL, node, unary(&tok, tok->next), tok);
-        }
-
-        if (equal(tok, "/")) {
+            continue;
+        case '/':
             node = new_binary(ND_DIV, node, unary(&tok, tok->next), tok);
+            continue;
         }
 
         *rest = tok;
@@ -473,17 +475,20 @@ Node *mul(Token **rest, Token *tok) {
 // unary = ("+" | "-" | "*" | "&") unary
 //       | postfix
 Node *unary(Token **rest, Token *tok) {
-    if (equal(tok, "+"))
+    switch (tok->id) {
+    case '+':
         return unary(rest, tok->next);
-
-    if (equal(tok, "-"))
+    case '-':
         return new_unary(ND_NEG, unary(rest, tok->next), tok);
-
-    if (equal(tok, "&"))
-        return new_unary(ND_ADDR, unary(rest, tok->next), tok);
-
-    if (equal(tok, "*"))
+    case '&': {
+        Node *node = new_unary(ND_ADDR, unary(rest, tok->next), tok);
+        if (node->lhs->kind == ND_VAR)
+            node->lhs->var->is_addr_taken = true;
+        return node;
+    }
+    case '*':
         return new_unary(ND_DEREF, unary(rest, tok->next), tok);
+    }
 
     return postfix(rest, tok);
 }
@@ -492,11 +497,11 @@ Node *unary(Token **rest, Token *tok) {
 Node *postfix(Token **rest, Token *tok) {
     Node *node = primary(&tok, tok);
 
-    while (equal(tok, "[")) {
+    while (tok->id == '[') {
         // x[y] is short for *(x+y)
         Token *start = tok;
         Node *idx = expr(&tok, tok->next);
-        tok = skip(tok, "]");
+        tok = skip(tok, ']');
         node = new_unary(ND_DEREF, new_add(node, idx, start), start);
     }
     *rest = tok;
@@ -511,16 +516,16 @@ Node *funcall(Token **rest, Token *tok) {
     Node head = {};
     Node *cur = &head;
 
-    while (!equal(tok, ")")) {
+    while (tok->id != ')') {
         if (cur != &head)
-            tok = skip(tok, ",");
+            tok = skip(tok, ',');
         cur = cur->next = assign(&tok, tok);
     }
 
-    *rest = skip(tok, ")");
+    *rest = skip(tok, ')');
 
     Node *node = new_node(ND_FUNCALL, start);
-    node->funcname = strndup(start->loc, start->len);
+    node->funcname = start->ident;
     node->args = head.next;
     add_type(node);
     return node;
@@ -528,20 +533,20 @@ Node *funcall(Token **rest, Token *tok) {
 
 // primary = "(" expr ")" | "sizeof" unary | ident func-args? | str | num
 Node *primary(Token **rest, Token *tok) {
-    if (equal(tok, "(")) {
+    if (tok->id == '(') {
         Node *node = expr(&tok, tok->next);
-        *rest = skip(tok, ")");
+        *rest = skip(tok, ')');
         return node;
     }
 
-    if (equal(tok, "sizeof")) {
+    if (tok->id == KW_SIZEOF) {
         Node *node = unary(rest, tok->next);
         return new_num(node->ty->size, tok);
     }
 
     if (tok->kind == TK_IDENT) {
         // Function call
-        if (equal(tok->next, "("))
+        if (tok->next->id == '(')
             return funcall(rest, tok);
 
         // Variable
@@ -580,14 +585,14 @@ Token *function(Token *tok, Type *basety) {
     Obj *fn = new_gvar(get_ident(ty->name), ty);
     fn->is_function = true;
 
-    locals = NULL;
+    tu->locals = NULL;
     enter_scope();
     create_param_lvars(ty->params);
-    fn->params = locals;
+    fn->params = tu->locals;
 
-    tok = skip(tok, "{");
+    tok = skip(tok, '{');
     fn->body = compound_stmt(&tok, tok);
-    fn->locals = locals;
+    fn->locals = tu->locals;
     leave_scope();
     return tok;
 }
@@ -595,9 +600,9 @@ Token *function(Token *tok, Type *basety) {
 Token *global_variable(Token *tok, Type *basety) {
     bool first = true;
 
-    while (!consume(&tok, tok, ";")) {
+    while (!consume(&tok, tok, ';')) {
         if (!first)
-            tok = skip(tok, ",");
+            tok = skip(tok, ',');
         first = false;
 
         Type *ty = declarator(&tok, tok, basety);
@@ -610,7 +615,7 @@ Token *global_variable(Token *tok, Type *basety) {
 // of a function definition or declaration.
 
 bool is_function(Token *tok) {
-    if (equal(tok, ";"))
+    if (tok->id == ';')
         return false;
 
     Type dummy = {};
@@ -620,7 +625,8 @@ bool is_function(Token *tok) {
 
 // program = function-definition*
 Obj *parse(Token *tok) {
-    globals = NULL;
+    tu->globals = NULL;
+    tu->scope = arena_alloc(&tu->scope_arena, sizeof(Scope));
 
     while (tok->kind != TK_EOF) {
         Type *basety = declspec(&tok, tok);
@@ -634,5 +640,10 @@ Obj *parse(Token *tok) {
         // Global variable
         tok = global_variable(tok, basety);
     }
-    return globals;
+
+    // Scopes are only needed while parsing
+    tu->scope = NULL;
+    hashmap_free(&tu->symtab);
+    arena_free(&tu->scope_arena);
+    return tu->globals;
 }
\ No newline at end of file
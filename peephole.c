@@ -0,0 +1,166 @@
+#include "mcc.h"
+
+// Peephole optimization of the machine instructions of a function, run
+// after register allocation so that both the assembly and the object
+// file writers see the result. Each rule looks at the instructions at
+// one position and rewrites them in place if they match. Rules are
+// tried again at the same position after one applies, so that the
+// result of a rule can be matched by another.
+//
+// Codegen only reads the flags right after the instruction that sets
+// them, so the flags are never live across a jump, and rules may change
+// the flags that a jump leaves behind.
+
+bool opt_peephole = true;
+
+typedef struct {
+    char *name;
+    // Rewrite the instructions starting at *p if they match, and return
+    // true if it did
+    bool (*apply)(Insn **p);
+} Rule;
+
+static bool is_reg(Operand *op, int r) {
+    return op->kind == OP_REG && op->reg == r;
+}
+
+// Returns true if `op` reads register `r`
+static bool uses_reg(Operand *op, int r) {
+    if (op->kind == OP_MEM)
+        return op->reg == r || (op->scale && op->index == r);
+    return is_reg(op, r);
+}
+
+// Returns true if `insn` sets all of register `r` without reading it
+static bool overwrites(Insn *insn, int r) {
+    switch (insn->kind) {
+    case I_POP:
+        return is_reg(&insn->dst, r);
+    case I_MOV:
+    case I_MOVSX:
+    case I_MOVZX:
+    case I_LEA:
+        return is_reg(&insn->dst, r) && insn->dst.size == 8 &&
+               !uses_reg(&insn->src, r);
+    }
+    return false;
+}
+
+// push X; pop Y => mov Y, X, or nothing if X is Y
+static bool push_pop(Insn **p) {
+    Insn *push = *p;
+    Insn *pop = push->next;
+    if (push->kind != I_PUSH || !pop || pop->kind != I_POP)
+        return false;
+
+    if (is_reg(&push->dst, pop->dst.reg)) {
+        *p = pop->next;
+        return true;
+    }
+    push->kind = I_MOV;
+    push->src = push->dst;
+    push->dst = pop->dst;
+    push->next = pop->next;
+    return true;
+}
+
+// mov R, N; push R => push N, if the next instruction overwrites R
+static bool push_imm(Insn **p) {
+    Insn *mov = *p;
+    Insn *push = mov->next;
+    if (mov->kind != I_MOV || mov->src.kind != OP_IMM ||
+        mov->src.val != (int)mov->src.val || mov->dst.kind != OP_REG ||
+        mov->dst.size != 8 || !push || push->kind != I_PUSH ||
+        !is_reg(&push->dst, mov->dst.reg) || !push->next ||
+        !overwrites(push->next, mov->dst.reg))
+        return false;
+
+    push->dst = mov->src;
+    *p = push;
+    return true;
+}
+
+// setcc R8; movzb R, R8; cmp R, 0; je L
+//   => setcc R8; movzb R, R8; jncc L
+//
+// The jump uses the flags that setcc reads. R is still set in case it
+// is used later.
+static bool setcc_branch(Insn **p) {
+    Insn *set = *p;
+    if (set->kind != I_SETCC)
+        return false;
+
+    int r = set->dst.reg;
+    Insn *movzb = set->next;
+    if (!movzb || movzb->kind != I_MOVZX || !is_reg(&movzb->dst, r) ||
+        !is_reg(&movzb->src, r))
+        return false;
+
+    Insn *cmp = movzb->next;
+    if (!cmp || cmp->kind != I_CMP || !is_reg(&cmp->dst, r) ||
+        cmp->dst.size != 8 || cmp->src.kind != OP_IMM || cmp->src.val != 0)
+        return false;
+
+    Insn *jcc = cmp->next;
+    if (!jcc || jcc->kind != I_JCC || (jcc->cc != CC_E && jcc->cc != CC_NE))
+        return false;
+
+    jcc->cc = jcc->cc == CC_E ? invert_cc(set->cc) : set->cc;
+    movzb->next = jcc;
+    return true;
+}
+
+// jmp L; L: => L:
+static bool jmp_next(Insn **p) {
+    Insn *jmp = *p;
+    if (jmp->kind != I_JMP)
+        return false;
+
+    for (Insn *insn = jmp->next; insn && insn->kind == I_LABEL;
+         insn = insn->next) {
+        if (!strcmp(insn->dst.sym, jmp->dst.sym)) {
+            *p = jmp->next;
+            return true;
+        }
+    }
+    return false;
+}
+
+static Rule rules[] = {
+    {"push-pop", push_pop},
+    {"push-imm", push_imm},
+    {"setcc-branch", setcc_branch},
+    {"jmp-next", jmp_next},
+};
+
+#define NUM_RULES (sizeof(rules) / sizeof(*rules))
+
+// Number of times each rule applied, summed over all functions
+static atomic_long fired[NUM_RULES];
+
+// Optimize the instruction list starting at *insns. This may be called
+// from several threads at once.
+void peephole(Insn **insns) {
+    long count[NUM_RULES] = {};
+
+    Insn **p = insns;
+    while (*p) {
+        int i = 0;
+        while (i < NUM_RULES && !rules[i].apply(p))
+            i++;
+        if (i < NUM_RULES)
+            count[i]++;
+        else
+            p = &(*p)->next;
+    }
+
+    for (int i = 0; i < NUM_RULES; i++)
+        if (count[i])
+            atomic_fetch_add(&fired[i], count[i]);
+}
+
+void print_peephole_stats(FILE *out) {
+    fprintf(out, "%-16s %10s\n", "peephole rule", "fired");
+    for (int i = 0; i < NUM_RULES; i++)
+        fprintf(out, "%-16s %10ld\n", rules[i].name, fired[i]);
+}
@@ -0,0 +1,577 @@
+#include "mcc.h"
+
+// Linear-scan register allocation (Poletto and Sarkar, 1999).
+//
+// Codegen gives each IR value a virtual register. The live interval of
+// a virtual register spans the instructions from its first to its last
+// occurrence and, for the few values that live across basic blocks such
+// as those hoisted out of loops, every block through which liveness
+// analysis finds them live. Intervals are visited in order of their
+// start; each gets a free machine register, or, if none is left, the
+// interval that ends last is spilled to a stack slot.
+//
+// rax and rdx are not allocated because division and return values use
+// them implicitly. r10 and r11 are kept as scratch registers for
+// spilled operands.
+
+static Reg alloc_regs[] = {RCX, RSI, RDI, R8, R9, R12, R13, R14, R15, RBX};
+
+#define NUM_ALLOC_REGS (sizeof(alloc_regs) / sizeof(*alloc_regs))
+
+static bool is_callee_saved(Reg r) {
+    return r == RBX || (R12 <= r && r <= R15);
+}
+
+static bool is_allocatable(Reg r) {
+    for (int i = 0; i < NUM_ALLOC_REGS; i++)
+        if (alloc_regs[i] == r)
+            return true;
+    return false;
+}
+
+typedef struct {
+    int vreg;
+    int start;
+    int end;
+    int reg;  // Allocated register, or -1 if spilled
+    int hint; // Virtual register this one is copied from, or -1
+} Interval;
+
+// Instruction indices [start, end] during which a machine register holds
+// something other than a virtual register: an argument from the time it
+// is set until the call, whatever a call leaves in a caller-saved
+// register, or a parameter until it is read.
+typedef struct {
+    int start;
+    int end;
+} Range;
+
+typedef struct {
+    Range *ranges;
+    int len;
+    int cap;
+} RangeList;
+
+typedef struct {
+    Arena *arena;
+    Interval *intervals; // Indexed by virtual register
+    RangeList fixed[16]; // Indexed by machine register
+    int *slots;          // Stack slot of each spilled virtual register
+    int stack_size;
+} RegAlloc;
+
+static void add_range(RegAlloc *ra, Reg r, int start, int end) {
+    RangeList *l = &ra->fixed[r];
+    if (l->len == l->cap) {
+        Range *old = l->ranges;
+        l->cap = l->cap ? l->cap * 2 : 16;
+        l->ranges = arena_alloc(ra->arena, sizeof(Range) * l->cap);
+        if (old)
+            memcpy(l->ranges, old, sizeof(Range) * l->len);
+    }
+    l->ranges[l->len++] = (Range){start, end};
+}
+
+// Returns true if `r` cannot hold a value that lives over [start, end].
+// The ranges are sorted and disjoint, so only the first one that ends
+// after `start` needs to be checked.
+static bool has_conflict(RegAlloc *ra, Reg r, Interval *it) {
+    RangeList *l = &ra->fixed[r];
+    int lo = 0, hi = l->len;
+    while (lo < hi) {
+        int mid = (lo + hi) / 2;
+        if (l->ranges[mid].end <= it->start)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return lo < l->len && l->ranges[lo].start < it->end;
+}
+
+static bool is_vreg(Operand *op) {
+    return op->kind == OP_REG && op->reg >= VREG_BASE;
+}
+
+// Store pointers to the registers that `insn` refers to in `refs`,
+// including the base and index of memory operands. Returns how many
+// there are.
+static int get_refs(Insn *insn, int **refs) {
+    int n = 0;
+    Operand *ops[] = {&insn->dst, &insn->src};
+    for (int i = 0; i < 2; i++) {
+        Operand *op = ops[i];
+        if (op->kind == OP_REG || op->kind == OP_MEM)
+            refs[n++] = &op->reg;
+        if (op->kind == OP_MEM && op->scale)
+            refs[n++] = &op->index;
+    }
+    return n;
+}
+
+// Returns true if the instruction overwrites its destination register
+// without reading it
+static bool is_def_only(Insn *insn) {
+    switch (insn->kind) {
+    case I_MOV:
+    case I_MOVSX:
+    case I_MOVZX:
+    case I_LEA:
+    case I_SETCC:
+        return insn->dst.kind == OP_REG;
+    }
+    return false;
+}
+
+// Returns true if the instruction writes its destination register
+static bool is_def(Insn *insn) {
+    if (insn->dst.kind != OP_REG)
+        return false;
+    switch (insn->kind) {
+    case I_ADD:
+    case I_SUB:
+    case I_SHL:
+    case I_SAR:
+    case I_SHR:
+    case I_NEG:
+        return true;
+    case I_IMUL:
+        // The one-operand form writes rdx:rax
+        return insn->src.kind != OP_NONE;
+    }
+    return is_def_only(insn);
+}
+
+static void touch(RegAlloc *ra, Insn *insn, int pos) {
+    int *refs[4];
+    int n = get_refs(insn, refs);
+    for (int i = 0; i < n; i++) {
+        if (*refs[i] < VREG_BASE)
+            continue;
+        Interval *it = &ra->intervals[*refs[i] - VREG_BASE];
+        if (it->start < 0)
+            it->start = pos;
+        it->end = pos;
+    }
+}
+
+// Returns true if `insn` jumps to another function
+static bool is_tail_jump(Insn *insn) {
+    return insn->kind == I_JMP && strncmp(insn->dst.sym, ".L", 2);
+}
+
+static bool is_copy(Insn *insn) {
+    return insn->kind == I_MOV && insn->dst.kind == OP_REG &&
+           insn->src.kind == OP_REG && insn->dst.size == insn->src.size;
+}
+
+// Compute the live intervals of virtual registers and the ranges in
+// which machine registers are unavailable
+static void build_intervals(RegAlloc *ra, Insn *insns) {
+    int set_at[16];
+    for (int i = 0; i < 16; i++)
+        set_at[i] = -1;
+
+    bool seen_call = false;
+    int pos = 0;
+    for (Insn *insn = insns; insn; insn = insn->next, pos++) {
+        touch(ra, insn, pos);
+
+        // A register that is read before anything sets it holds a
+        // parameter from the start of the function
+        Operand *src = &insn->src;
+        if (!seen_call && src->kind == OP_REG && src->reg < VREG_BASE &&
+            is_allocatable(src->reg) && set_at[src->reg] < 0)
+            add_range(ra, src->reg, 0, pos);
+
+        // Codegen copies the first operand of an arithmetic instruction
+        // into its result, so it pays to give both the same register
+        if (is_copy(insn) && is_vreg(&insn->dst) && is_vreg(&insn->src)) {
+            Interval *it = &ra->intervals[insn->dst.reg - VREG_BASE];
+            if (it->start == pos)
+                it->hint = insn->src.reg - VREG_BASE;
+        }
+
+        if (insn->kind == I_MOV && insn->dst.kind == OP_REG &&
+            insn->dst.reg < VREG_BASE && set_at[insn->dst.reg] < 0)
+            set_at[insn->dst.reg] = pos;
+
+        // A tail call holds its arguments until the jump
+        if (insn->kind == I_CALL || is_tail_jump(insn)) {
+            for (int i = 0; i < NUM_ALLOC_REGS; i++) {
+                Reg r = alloc_regs[i];
+                if (is_callee_saved(r))
+                    continue;
+                add_range(ra, r, set_at[r] < 0 ? pos : set_at[r], pos);
+            }
+            for (int i = 0; i < 16; i++)
+                set_at[i] = -1;
+            seen_call = true;
+        }
+    }
+}
+
+// A basic block of machine code, for liveness analysis. The sets are
+// bitsets over the virtual registers that occur in more than one block.
+typedef struct MBlock MBlock;
+struct MBlock {
+    int start; // Position of the first instruction
+    int end;   // Position of the last instruction
+    MBlock *succ[2];
+    int nsucc;
+    uint64_t *use; // Read before being written in the block
+    uint64_t *def; // Written in the block
+    uint64_t *in;  // Live on entry
+    uint64_t *out; // Live on exit
+};
+
+static bool is_jump(Insn *insn) {
+    return insn->kind == I_JMP || insn->kind == I_JCC;
+}
+
+static bool starts_block(Insn *prev, Insn *insn) {
+    return !prev || insn->kind == I_LABEL || is_jump(prev) ||
+           prev->kind == I_RET;
+}
+
+static bool test_bit(uint64_t *set, int i) {
+    return set[i / 64] & (1UL << (i % 64));
+}
+
+static void set_bit(uint64_t *set, int i) { set[i / 64] |= 1UL << (i % 64); }
+
+static void extend(Interval *it, int pos) {
+    if (pos < it->start)
+        it->start = pos;
+    if (pos > it->end)
+        it->end = pos;
+}
+
+// Extend the intervals of virtual registers that live across blocks to
+// cover the blocks through which they are live
+static void extend_intervals(RegAlloc *ra, Insn *insns, int num_vregs) {
+    int nblocks = 0;
+    Insn *prev = NULL;
+    for (Insn *insn = insns; insn; prev = insn, insn = insn->next)
+        if (starts_block(prev, insn))
+            nblocks++;
+
+    MBlock *bbs = arena_alloc(ra->arena, sizeof(MBlock) * nblocks);
+    int *block_of = arena_alloc(ra->arena, sizeof(int) * num_vregs);
+    int *index = arena_alloc(ra->arena, sizeof(int) * num_vregs);
+    int *vregs = arena_alloc(ra->arena, sizeof(int) * num_vregs);
+    int nglobals = 0;
+    for (int i = 0; i < num_vregs; i++)
+        block_of[i] = index[i] = -1;
+
+    // Split the code into blocks and find the virtual registers that
+    // occur in more than one
+    HashMap labels = {};
+    MBlock *bb = bbs - 1;
+    prev = NULL;
+    int pos = 0;
+    for (Insn *insn = insns; insn; prev = insn, insn = insn->next, pos++) {
+        if (starts_block(prev, insn))
+            (++bb)->start = pos;
+        bb->end = pos;
+        if (insn->kind == I_LABEL)
+            hashmap_put2(&labels, insn->dst.sym, strlen(insn->dst.sym), bb);
+
+        int *refs[4];
+        int n = get_refs(insn, refs);
+        for (int i = 0; i < n; i++) {
+            int v = *refs[i] - VREG_BASE;
+            if (v < 0)
+                continue;
+            if (block_of[v] < 0)
+                block_of[v] = bb - bbs;
+            else if (block_of[v] != bb - bbs && index[v] < 0)
+                vregs[index[v] = nglobals++] = v;
+        }
+    }
+
+    if (nglobals == 0) {
+        hashmap_free(&labels);
+        return;
+    }
+
+    int words = (nglobals + 63) / 64;
+    for (int i = 0; i < nblocks; i++) {
+        uint64_t *sets = arena_alloc(ra->arena, sizeof(uint64_t) * words * 4);
+        bbs[i].use = sets;
+        bbs[i].def = sets + words;
+        bbs[i].in = sets + words * 2;
+        bbs[i].out = sets + words * 3;
+    }
+
+    bb = bbs - 1;
+    prev = NULL;
+    for (Insn *insn = insns; insn; prev = insn, insn = insn->next) {
+        if (starts_block(prev, insn)) {
+            bb++;
+            if (prev && !is_jump(prev) && prev->kind != I_RET)
+                bb[-1].succ[bb[-1].nsucc++] = bb;
+            if (prev && prev->kind == I_JCC)
+                bb[-1].succ[bb[-1].nsucc++] = bb;
+        }
+
+        // A jump out of the function, as to a tail-called function, has
+        // no successor here
+        if (is_jump(insn)) {
+            MBlock *dest = hashmap_get2(&labels, insn->dst.sym,
+                                        strlen(insn->dst.sym));
+            if (dest)
+                bb->succ[bb->nsucc++] = dest;
+        }
+
+        // Registers are read before the instruction writes its result
+        int *refs[4];
+        int n = get_refs(insn, refs);
+        for (int i = 0; i < n; i++) {
+            int v = *refs[i] - VREG_BASE;
+            if (v < 0 || index[v] < 0)
+                continue;
+            bool is_dst = refs[i] == &insn->dst.reg && insn->dst.kind == OP_REG;
+            if ((!is_dst || !is_def_only(insn)) && !test_bit(bb->def, index[v]))
+                set_bit(bb->use, index[v]);
+        }
+        if (is_def(insn) && insn->dst.reg >= VREG_BASE &&
+            index[insn->dst.reg - VREG_BASE] >= 0)
+            set_bit(bb->def, index[insn->dst.reg - VREG_BASE]);
+    }
+    hashmap_free(&labels);
+
+    // Solve the backward dataflow equations
+    //   out = union of in of successors
+    //   in = use | (out - def)
+    for (bool changed = true; changed;) {
+        changed = false;
+        for (int i = nblocks - 1; i >= 0; i--) {
+            MBlock *bb = &bbs[i];
+            for (int w = 0; w < words; w++) {
+                uint64_t out = 0;
+                for (int j = 0; j < bb->nsucc; j++)
+                    out |= bb->succ[j]->in[w];
+                uint64_t in = bb->use[w] | (out & ~bb->def[w]);
+                if (in != bb->in[w])
+                    changed = true;
+                bb->out[w] = out;
+                bb->in[w] = in;
+            }
+        }
+    }
+
+    for (int i = 0; i < nblocks; i++) {
+        for (int g = 0; g < nglobals; g++) {
+            Interval *it = &ra->intervals[vregs[g]];
+            if (test_bit(bbs[i].in, g))
+                extend(it, bbs[i].start);
+            if (test_bit(bbs[i].out, g))
+                extend(it, bbs[i].end);
+        }
+    }
+}
+
+static int cmp_start(const void *a, const void *b) {
+    return (*(Interval **)a)->start - (*(Interval **)b)->start;
+}
+
+static int new_slot(RegAlloc *ra) {
+    ra->stack_size += 8;
+    return ra->stack_size;
+}
+
+static void spill(RegAlloc *ra, Interval *it) {
+    it->reg = -1;
+    ra->slots[it->vreg] = new_slot(ra);
+}
+
+static void linear_scan(RegAlloc *ra, int num_vregs) {
+    Interval **order = arena_alloc(ra->arena, sizeof(Interval *) * num_vregs);
+    int n = 0;
+    for (int i = 0; i < num_vregs; i++)
+        if (ra->intervals[i].start >= 0)
+            order[n++] = &ra->intervals[i];
+    qsort(order, n, sizeof(Interval *), cmp_start);
+
+    // Intervals that currently hold a register, sorted by end
+    Interval *active[NUM_ALLOC_REGS];
+    int num_active = 0;
+    bool busy[16] = {};
+
+    for (int i = 0; i < n; i++) {
+        Interval *cur = order[i];
+
+        // Expire intervals that end before this one starts. An interval
+        // that ends where another starts can pass its register on,
+        // e.g. in "mov v2, [v1]".
+        int j = 0;
+        for (; j < num_active && active[j]->end <= cur->start; j++)
+            busy[active[j]->reg] = false;
+        memmove(active, active + j, sizeof(Interval *) * (num_active - j));
+        num_active -= j;
+
+        cur->reg = -1;
+        if (cur->hint >= 0) {
+            int r = ra->intervals[cur->hint].reg;
+            if (r >= 0 && !busy[r] && !has_conflict(ra, r, cur))
+                cur->reg = r;
+        }
+        for (int k = 0; cur->reg < 0 && k < NUM_ALLOC_REGS; k++) {
+            Reg r = alloc_regs[k];
+            if (!busy[r] && !has_conflict(ra, r, cur))
+                cur->reg = r;
+        }
+
+        if (cur->reg < 0) {
+            // Take the register of the interval that ends last if that
+            // is later than this one
+            int victim = -1;
+            for (int k = num_active - 1; k >= 0; k--) {
+                if (active[k]->end <= cur->end)
+                    break;
+                if (!has_conflict(ra, active[k]->reg, cur)) {
+                    victim = k;
+                    break;
+                }
+            }
+            if (victim < 0) {
+                spill(ra, cur);
+                continue;
+            }
+            cur->reg = active[victim]->reg;
+            spill(ra, active[victim]);
+            memmove(active + victim, active + victim + 1,
+                    sizeof(Interval *) * (num_active - victim - 1));
+            num_active--;
+        }
+
+        busy[cur->reg] = true;
+        int k = num_active++;
+        for (; k > 0 && active[k - 1]->end > cur->end; k--)
+            active[k] = active[k - 1];
+        active[k] = cur;
+    }
+}
+
+static Insn *insert_after(RegAlloc *ra, Insn *pos, InsnKind kind,
+                          Operand dst, Operand src) {
+    Insn *insn = new_insn(ra->arena, kind, dst, src);
+    insn->next = pos->next;
+    pos->next = insn;
+    return insn;
+}
+
+// Replace virtual registers in `insn` with machine registers. A spilled
+// register is loaded into a scratch register before the instruction and
+// stored back after it if it is written. Codegen refers to at most three
+// distinct virtual registers in one instruction, and to three only in a
+// load or store with an index register, around which rax is free too.
+// `prev` is the instruction before `insn`; returns the last instruction
+// of the rewritten sequence.
+static Insn *rewrite(RegAlloc *ra, Insn *prev, Insn *insn) {
+    static Reg scratch[] = {R10, R11, RAX};
+    int spilled[3];
+    bool is_used[3] = {};
+    int nspilled = 0;
+
+    int *refs[4];
+    int n = get_refs(insn, refs);
+    for (int i = 0; i < n; i++) {
+        if (*refs[i] < VREG_BASE)
+            continue;
+
+        int vreg = *refs[i] - VREG_BASE;
+        Interval *it = &ra->intervals[vreg];
+        if (it->reg >= 0) {
+            *refs[i] = it->reg;
+            continue;
+        }
+
+        // The same register may appear more than once
+        int j = 0;
+        while (j < nspilled && spilled[j] != vreg)
+            j++;
+        if (j == nspilled) {
+            assert(nspilled < 3);
+            spilled[nspilled++] = vreg;
+        }
+        *refs[i] = scratch[j];
+
+        bool is_dst = refs[i] == &insn->dst.reg && insn->dst.kind == OP_REG;
+        if (!is_dst || !is_def_only(insn))
+            is_used[j] = true;
+    }
+
+    if (nspilled == 0)
+        return insn;
+
+    for (int j = 0; j < nspilled; j++)
+        if (is_used[j])
+            prev = insert_after(ra, prev, I_MOV, reg(scratch[j]),
+                                mem(RBP, -ra->slots[spilled[j]], 8));
+
+    Insn *last = insn;
+    if (is_def(insn)) {
+        for (int j = 0; j < nspilled; j++)
+            if (insn->dst.reg == scratch[j])
+                last = insert_after(ra, last, I_MOV,
+                                    mem(RBP, -ra->slots[spilled[j]], 8),
+                                    reg(scratch[j]));
+    }
+    return last;
+}
+
+// Returns true if `insn` starts an epilogue, of which a function with
+// tail calls has several
+static bool is_epilogue(Insn *insn) {
+    return insn->kind == I_MOV && insn->dst.kind == OP_REG &&
+           insn->dst.reg == RSP && insn->src.kind == OP_REG &&
+           insn->src.reg == RBP;
+}
+
+// Assign machine registers to the virtual registers in `insns`. `frame`
+// is the instruction that allocates the stack frame; callee-saved
+// registers are saved after it and restored before each epilogue.
+void regalloc(Insn *insns, int num_vregs, Insn *frame, Arena *arena) {
+    RegAlloc ra = {arena};
+    ra.intervals = arena_alloc(arena, sizeof(Interval) * (num_vregs + 1));
+    ra.slots = arena_alloc(arena, sizeof(int) * (num_vregs + 1));
+    ra.stack_size = frame->src.val;
+    for (int i = 0; i < num_vregs; i++)
+        ra.intervals[i] = (Interval){i, -1, -1, -1, -1};
+
+    build_intervals(&ra, insns);
+    extend_intervals(&ra, insns, num_vregs);
+    linear_scan(&ra, num_vregs);
+
+    Insn head = {insns};
+    Insn *prev = &head;
+    for (Insn *insn = insns; insn; insn = insn->next) {
+        insn = rewrite(&ra, prev, insn);
+
+        // Remove copies that ended up in the same register
+        if (is_copy(insn) && insn->dst.reg == insn->src.reg) {
+            prev->next = insn->next;
+            continue;
+        }
+        prev = insn;
+    }
+
+    bool used[16] = {};
+    for (int i = 0; i < num_vregs; i++)
+        if (ra.intervals[i].reg >= 0)
+            used[ra.intervals[i].reg] = true;
+
+    for (int i = 0; i < NUM_ALLOC_REGS; i++) {
+        Reg r = alloc_regs[i];
+        if (!used[r] || !is_callee_saved(r))
+            continue;
+        Operand slot = mem(RBP, -new_slot(&ra), 8);
+        insert_after(&ra, frame, I_MOV, slot, reg(r));
+        for (Insn *prev = &head; prev->next; prev = prev->next)
+            if (is_epilogue(prev->next))
+                prev = insert_after(&ra, prev, I_MOV, reg(r), slot);
+    }
+
+    frame->src.val = (ra.stack_size + 15) / 16 * 16;
+}
@@ -0,0 +1,64 @@
+#include "mcc.h"
+
+// Tail calls. In "return f(...)", nothing is left to do after f returns,
+// so the caller's frame can be freed before f is entered: codegen moves
+// the arguments into their registers, runs the epilogue and jumps to f,
+// which then returns straight to our caller. A call of the function
+// itself becomes a jump back to the start of its body, after the
+// arguments are assigned to the parameters, so that recursion of that
+// kind runs in constant stack space.
+//
+// This is only done if no local of the caller is reachable through a
+// pointer, which would dangle once the frame is reused or gone.
+
+#define MAX_REG_ARGS 6
+
+static int count_args(Node *node) {
+    int n = 0;
+    for (Node *arg = node->args; arg; arg = arg->next)
+        n++;
+    return n;
+}
+
+// Returns true if `node`, the value of a return statement in `fn`, is a
+// call that can be a tail call
+bool is_tail_call(Node *node, Obj *fn) {
+    if (node->kind != ND_FUNCALL || count_args(node) > MAX_REG_ARGS)
+        return false;
+
+    for (Obj *var = fn->locals; var; var = var->next)
+        if (var->is_addr_taken || var->ty->kind == TY_ARRAY)
+            return false;
+    return true;
+}
+
+// Returns true if `node` is a tail call of `fn` itself with an argument
+// for each parameter
+bool is_self_tail_call(Node *node, Obj *fn) {
+    if (!is_tail_call(node, fn) || strcmp(node->funcname, fn->name))
+        return false;
+
+    int nparams = 0;
+    for (Obj *var = fn->params; var; var = var->next)
+        nparams++;
+    return count_args(node) == nparams;
+}
+
+// Returns true if statement `node` of `fn` contains a self tail call
+bool has_self_tail_call(Node *node, Obj *fn) {
+    switch (node->kind) {
+    case ND_RETURN:
+        return is_self_tail_call(node->lhs, fn);
+    case ND_IF:
+        return has_self_tail_call(node->then, fn) ||
+               (node->els && has_self_tail_call(node->els, fn));
+    case ND_FOR:
+        return has_self_tail_call(node->then, fn);
+    case ND_BLOCK:
+        for (Node *n = node->body; n; n = n->next)
+            if (has_self_tail_call(n, fn))
+                return true;
+        return false;
+    }
+    return false;
+}
@@ -1,5 +1,5 @@
 #!/bin/bash
-cat << EOF | gcc -xc -c -o tmp2.o -
+helpers='
 int ret3() { return 3; }
 int ret5() { return 5; }
 int add(int x, int y) { return x+y; }
@@ -8,16 +8,36 @@ int sub(int x, int y) { return x-y; }
 int add6(int a, int b, int c, int d, int e, int f) {
     return a+b+c+d+e+f;
 }
-
-EOF
+'
+echo "$helpers" | gcc -xc -c -o tmp2.o -
+
+# Arguments are passed to mcc. With -c, mcc writes object files with its
+# built-in assembler instead of assembly text. With --run, mcc runs the
+# programs itself, so the helpers above are compiled along with them.
+flags="$*"
+case " $flags " in
+*" -c "*) out=tmp.o ;;
+*) out=tmp.s ;;
+esac
+
+compile_and_run() {
+    case " $flags " in
+    *" --run "*)
+        echo "$helpers $1" | ./mcc $flags -
+        return
+        ;;
+    esac
+
+    echo "$1" | ./mcc $flags -o $out - || exit
+    cc -o tmp $out tmp2.o
+    ./tmp
+}
 
 assert() {
     expected="$1"
     input="$2"
 
-    echo "$input" | ./mcc -o tmp.s - || exit
-    cc -o tmp tmp.s tmp2.o
-    ./tmp
+    compile_and_run "$input"
     actual="$?"
 
     if [ "$actual" = "$expected" ]; then
@@ -35,6 +55,9 @@ assert 41 'int main() { return  12 + 34 - 5 ; }'
 assert 47 'int main() { return 5+6*7; }'
 assert 15 'int main() { return 5*(9-6); }'
 assert 4 'int main() { return (3+5)/2; }'
+assert 24 'int main() { return 2*3*4; }'
+assert 2 'int main() { return 16/2/4; }'
+assert 9 'int main() { return 2*9/3*6/4; }'
 assert 10 'int main() { return -10+20; }'
 assert 10 'int main() { return - -10; }'
 assert 10 'int main() { return - - +10; }'
@@ -87,12 +110,12 @@ assert 55 'int main() { int i=0; int j=0; while(i<=10) {j=i+j; i=i+1;} return j;
 
 assert 3 'int main() { int x=3; return *&x; }'
 assert 3 'int main() { int x=3; int *y=&x; int **z=&y; return **z; }'
-assert 5 'int main() { int x=3; int y=5; return *(&x+1); }'
-assert 3 'int main() { int x=3; int y=5; return *(&y-1); }'
-assert 5 'int main() { int x=3; int y=5; return *(&x-(-1)); }'
+assert 5 'int main() { int x=3; int y=5; &y; return *(&x+1); }'
+assert 3 'int main() { int x=3; int y=5; &x; return *(&y-1); }'
+assert 5 'int main() { int x=3; int y=5; &y; return *(&x-(-1)); }'
 assert 5 'int main() { int x=3; int *y=&x; *y=5; return x; }'
-assert 7 'int main() { int x=3; int y=5; *(&x+1)=7; return y; }'
-assert 7 'int main() { int x=3; int y=5; *(&y-2+1)=7; return x; }'
+assert 7 'int main() { int x=3; int y=5; &y; *(&x+1)=7; return y; }'
+assert 7 'int main() { int x=3; int y=5; &x; *(&y-2+1)=7; return x; }'
 assert 5 'int main() { int x=3; return (&x+2)-&x+3; }'
 assert 8 'int main() { int x, y; x=3; y=5; return x+y; }'
 assert 8 'int main() { int x=3, y=5; return x+y; }'
@@ -102,6 +125,8 @@ assert 5 'int main() { return ret5(); }'
 assert 8 'int main() { return add(3, 5); }'
 assert 2 'int main() { return sub(5, 3); }'
 assert 21 'int main() { return add6(1,2,3,4,5,6); }'
+assert 3 'int main() { return sub(-200, -203); }'
+assert 3 'int main() { return sub(100000, 99997); }'
 assert 66 'int main() { return add6(1,2,add6(3,4,5,6,7,8),9,10,11); }'
 assert 136 'int main() { return add6(1,2,add6(3,add6(4,5,6,7,8,9),10,11,12,13),14,15,16); }'
 
@@ -213,5 +238,228 @@ return 2; }'
 assert 2 'int main() { int x=2; { int x=3; } return x; }'
 assert 2 'int main() { int x=2; { int x=3; } { int y=4; return x; }}'
 assert 3 'int main() { int x=2; { x=3; } return x; }'
+assert 3 'int x; int main() { x=3; { int x=4; { int x=5; } } return x; }'
+assert 7 'int main() { int x=2; { int x=3; { int y=x+4; return y; } } }'
+
+# Comparisons in branch conditions
+assert 42 'int main() { int i; int s; s=0; for (i=0; i<10; i=i+1) if (i!=3) s=s+i; return s; }'
+assert 55 'int main() { int i; int s; s=0; for (i=0; i<=10; i=i+1) s=s+i; return s; }'
+assert 3 'int main() { int i; i=0; while (i==0) i=3; return i; }'
+assert 7 'int main() { int x; x=5; if (x<=5) x=x+2; else x=0; return x; }'
+assert 1 'int main() { int x; x=5; if (5<x) return 0; if (x<5) return 0; if (x==4) return 0; return x!=4; }'
+assert 1 'int main() { int x; x=ret3()<ret5(); if (x) return x; return 9; }'
+
+# Constant folding and simplification
+assert 1 'int main() { return 65536*65536*65536/65536/65536/65536; }'
+assert 6 'int main() { int x; x=3; return x+0+x*1-(x-x)+0*x+x/1-3; }'
+assert 5 'int main() { int x; x=1; 0*(x=5); return x; }'
+assert 9 'int main() { int a[4]; int *p; a[3]=9; p=a; return *(p+1+2); }'
+assert 2 'int main() { int a[4]; int *p; a[1]=2; p=a+3; return *(p-1-1); }'
+assert 2 'int main() { if (0) return 1; else return 2; }'
+assert 3 'int main() { if (1-1+1) return 3; return 4; }'
+assert 5 'int main() { for (;0;) return 1; return 5; }'
+assert 7 'int main() { int i; for (i=7; 2<1;) return 1; return i; }'
+assert 4 'int main() { int i; i=0; for (;1;) { i=i+1; if (i==4) return i; } }'
+
+# Loop-invariant code motion
+assert 72 'int main() { int i; int j; int n; int k; int s; n=3; k=2; s=0; for (i=0; i<n; i=i+1) for (j=0; j<n; j=j+1) s=s+n*k+i*k; return s; }'
+assert 5 'int main() { int i; int n; int s; n=0; s=5; for (i=0; i<n; i=i+1) s=s+10/n; return s; }'
+assert 30 'int main() { int i; int k; int s; k=1; s=0; for (i=0; i<5; i=i+1) { s=s+k*2; k=k+1; } return s; }'
+assert 30 'int main() { int i; int k; int *p; int s; p=&k; k=1; s=0; for (i=0; i<5; i=i+1) { s=s+k*2; *p=*p+1; } return s; }'
+assert 33 'int main() { int i; int k; int s; k=5; s=0; for (i=0; i<3; i=i+1) s=s+add(k*2, i); return s; }'
+assert 180 'int main() { int a; int b; int c; int d; int e; int i; int s; a=1; b=2; c=3; d=4; e=5; s=0; i=0; while (i<2) { s=s+a*b+a*c+b*c+a*d+b*d+c*d+a*e+b*e+c*e+d*e+a*a+b*b; i=i+1; } return s; }'
+
+# Locals and parameters whose address is not taken, which live in
+# registers
+assert 44 'int main() { char c; c=300; return c; }'
+assert 44 'int f(char c) { return c; } int main() { return f(300); }'
+assert 8 'int main() { int x; x=3; return (x=5)+x; }'
+assert 10 'int main() { int x; x=3; return x+(x=5); }'
+assert 53 'int main() { int a; int b; int t; a=3; b=5; t=a; a=b; b=t; return a*10+b; }'
+assert 7 'int main() { int x; int y; x=3; y=10; x=y-x; return x; }'
+assert 45 'int f(int a, int b, int c, int d, int e, int g) { return ((((a*2+b)*2+c)*2+d)*2+e)*2+g; } int main() { return f(1, 0, 1, 1, 0, 1); }'
+assert 21 'int f(int a, int b) { int c; c=add(b, 1); return a*10+c; } int main() { return f(2, 0); }'
+
+# Addressing modes and immediate operands
+assert 20 'int main() { int a[4]; int i; i=1; a[2]=0; a[i]=(i=i+1); return a[1]*10+a[2]; }'
+assert 44 'int main() { char s[4]; s[1]=300; return s[1]; }'
+assert 27 'int main() { int a[3]; int *p; p=a; *(p+2)=9; return a[2]+*(p+2)+p[2]; }'
+assert 25 'int g[5]; int main() { int i; for (i=0; i<5; i=i+1) g[i]=i*i; return g[4]+g[3]; }'
+assert 6 'char g[5]; int main() { int i; for (i=0; i<5; i=i+1) g[i]=i; return g[i-1]+g[2]; }'
+assert 3 'int main() { int x; x=7; return (x==7)+(x<8)*2+(x<=6)*4; }'
+assert 1 'int main() { int a[2]; a[1]=4294967296; return a[1]/4294967296; }'
+assert 5 'int main() { int x; x=5; return x+4294967296-4294967296; }'
+
+# Operands evaluated in Sethi-Ullman order, except around side effects
+assert 5 'int main() { int a[6]; int i; for (i=0; i<6; i=i+1) a[i]=i*i; return 20+a[5]-a[4]-a[3]-a[2]-a[1]-a[0]+(a[1]-(a[2]-(a[3]-a[4]))); }'
+assert 7 'int main() { int a[6]; int i; for (i=0; i<6; i=i+1) a[i]=i+2; return (a[5]*a[4]-a[3])/(a[2]+1)+(a[5]*a[5]<a[4])+(a[1]*a[2]*a[3]==a[4]+a[1])*7; }'
+assert 21 'int main() { int x; x=1; return (x=x+1)*10+x*x*x; }'
+
+# Tail calls, which run in constant stack space
+assert 1 'int main() { return sum(10000000, 0) == 50000005000000; } int sum(int n, int acc) { if (n == 0) return acc; return sum(n-1, acc+n); }'
+assert 21 'int main() { return swap(1, 2, 5); } int swap(int a, int b, int n) { if (n == 0) return a*10+b; return swap(b, a, n-1); }'
+assert 0 'int main() { return even(10000001); } int odd(int n) { if (n == 0) return 0; return even(n-1); } int even(int n) { if (n == 0) return 1; return odd(n-1); }'
+assert 8 'int main() { int x=ret3(); int y=ret5(); return add(x, y); }'
+assert 1 'int main() { int y=9; return f(3, &y); } int f(int n, int *p) { int x; x=n; if (n == 0) return *p; return f(n-1, &x); }'
+
+# Counted loops, which are unrolled with -funroll-loops
+assert 45 'int main() { int i; int s; s=0; for (i=0; i<10; i=i+1) s=s+i; return s; }'
+assert 55 'int main() { int i; int s; s=0; for (i=0; i<=10; i=i+1) s=s+i; return s; }'
+assert 0 'int main() { int i; int n; int s; n=0; s=0; for (i=0; i<n; i=i+1) s=s+1; return s; }'
+assert 1 'int main() { int i; int n; int s; n=1; s=0; for (i=0; i<n; i=i+1) s=s+1; return s; }'
+assert 2 'int main() { int i; int n; int s; n=2; s=0; for (i=0; i<n; i=i+1) s=s+1; return s; }'
+assert 11 'int main() { int i; int n; int s; n=11; s=0; for (i=0; i<n; i=i+1) s=s+1; return s; }'
+assert 25 'int main() { int i; int n; int s; n=10; s=0; for (i=1; i<n; i=2+i) s=s+i; return s; }'
+assert 13 'int main() { int i; int s; s=0; for (i=-5; i<=2; i=i+3) s=s+i+5; return s+4; }'
+assert 7 'int main() { int i; for (i=0; i<100; i=i+1) if (i==7) return i; return 0; }'
+assert 10 'int main() { int a[10]; int i; for (i=0; i<10; i=i+1) a[i]=i+1; return a[9]; }'
+assert 6 'int main() { int i; int n; int *p; int s; n=8; p=&n; s=0; for (i=0; i<n; i=i+1) { s=s+1; *p=6; } return s; }'
+assert 6 'int main() { int i; int n; int s; n=8; s=0; for (i=0; i<n; i=i+1) { s=s+1; n=6; } return s; }'
+assert 12 'int main() { int i; int j; int s; s=0; for (i=0; i<3; i=i+1) for (j=0; j<4; j=j+1) s=s+1; return s; }'
+
+# Loops over arrays, which are vectorized. The AVX2 versions run too if
+# the machine has AVX2.
+vector_tests() {
+    assert 40 'int main() { int a[40]; int b[40]; int c[40]; int i; int n; int ok; n=37; for (i=0; i<40; i=i+1) { a[i]=0; b[i]=i*3; c[i]=i*i; } for (i=1; i<n; i=i+1) a[i]=b[i]+c[i]-b[i]; ok=0; for (i=0; i<40; i=i+1) ok=ok+(a[i]==i*i)*(i>=1)*(i<n)+(a[i]==0)*((i<1)+(i>=n)); return ok; }'
+    assert 70 'int main() { char p[70]; char q[70]; char c; int i; int n; int ok; n=66; for (i=0; i<70; i=i+1) { p[i]=i*7; q[i]=i*13; } for (i=0; i<=n; i=i+1) p[i]=p[i]+q[i]; ok=0; for (i=0; i<70; i=i+1) { c=i*20; if (i>n) c=i*7; ok=ok+(p[i]==c); } return ok; }'
+    assert 3 'int main() { int a[4]; int i; int n; n=0; a[0]=3; for (i=0; i<n; i=i+1) a[i]=a[i]+a[i]; return a[0]; }'
+    assert 35 'int f(int *a, int *b, int *c, int n) { int i; for (i=0; i<n; i=i+1) a[i]=b[i]+c[i]; return 0; } int main() { int x[40]; int one[40]; int i; for (i=0; i<40; i=i+1) { x[i]=0; one[i]=1; } x[0]=5; f(x+1, x, one, 30); return x[30]; }'
+    assert 35 'int f(int *a, int *b, int *c, int n) { int i; for (i=0; i<n; i=i+1) a[i]=b[i]+c[i]; return 0; } int main() { int x[40]; int one[40]; int i; for (i=0; i<40; i=i+1) { x[i]=0; one[i]=1; } x[0]=5; f(x+2, x, one, 30); return x[30]+x[31]; }'
+    assert 61 'int f(int *a, int *b, int *c, int n) { int i; for (i=0; i<n; i=i+1) a[i]=b[i]+c[i]; return 0; } int main() { int x[40]; int one[40]; int i; for (i=0; i<40; i=i+1) { x[i]=i; one[i]=1; } f(x, x+1, one, 30); return x[29]+x[30]; }'
+    assert 123 'int f(char *a, char *b, int n) { int i; for (i=0; i<n; i=i+1) a[i]=a[i]+b[i]; return 0; } int main() { char x[40]; int i; for (i=0; i<40; i=i+1) x[i]=1; f(x, x, 37); f(x+20, x, 17); f(x+1, x, 10); return x[36]+x[39]+x[0]+x[37]*50+x[10]*3; }'
+    assert 29 'int g[30]; int h[30]; int main() { int i; for (i=0; i<30; i=i+1) h[i]=i; for (i=0; i<30; i=i+1) g[i]=h[i]-g[i]; return g[29]; }'
+}
+vector_tests
+if grep -qw avx2 /proc/cpuinfo; then
+    flags="$flags -mavx2"
+    vector_tests
+    flags="$*"
+fi
+
+# Enough temporaries to run out of registers, and values that live
+# across calls
+assert 136 'int main() { return 1+(2+(3+(4+(5+(6+(7+(8+(9+(10+(11+(12+(13+(14+(15+16)))))))))))))); }'
+assert 136 'int main() { return ((((((((((((((1+2)+3)+4)+5)+6)+7)+8)+9)+10)+11)+12)+13)+14)+15)+16; }'
+assert 17 'int main() { return 1+add6(1,2,3,4,5,add(1,2))-ret3()+sub(add(2,ret5()),ret3())-3; }'
+assert 60 'int main() { return add6(1,add6(1,2,3,4,5,6),add6(1,2,3,4,5,6),ret3(),ret5(),add(1,2)*ret3()); }'
+assert 16 'int main() { int a[3]; char b[3]; a[0]=1; a[1]=2; b[2]=3; return (a[0]+a[1])*(b[2]+a[0]*(a[1]+10))/3+(a[0]<a[1])*(a[1]==2)*(b[2]!=3)+(a[0]<=1); }'
+
+# Multiplication and division by constants, checked against gcc over
+# the whole value range. int is 64 bits wide in mcc, hence -Dint=long.
+# With --run there is nothing to link the checker with.
+case " $flags " in
+*" --run "*) ;;
+*)
+    consts='1 2 3 4 5 6 7 8 9 10 11 12 13 15 16 17 24 25 31 32 36 40 45
+        63 64 72 100 127 128 255 641 1000 4096 65537 6700417 1000000007
+        2147483647 2147483648 4294967296 1099511627776 4611686018427387904
+        9223372036854775807 (-9223372036854775807-1)'
+    nmul=0
+    ndiv=0
+    {
+        echo 'int cmul(int x, int i) {'
+        echo "if (i==$((nmul++))) return x*0;"
+        for c in $consts; do
+            for e in "$c" "-$c"; do
+                echo "if (i==$((nmul++))) return x*$e;"
+                echo "if (i==$((nmul++))) return $e*x;"
+            done
+        done
+        echo 'return 0; }'
+        echo 'int cdiv(int x, int i) {'
+        for c in $consts; do
+            for e in "$c" "-$c"; do
+                [ "$e" = -1 ] && div_m1=$ndiv
+                echo "if (i==$((ndiv++))) return x/$e;"
+            done
+        done
+        echo 'return 0; }'
+    } > tmp-sr
+    sr_out=tmp-sr.${out#tmp.}
+    ./mcc $flags -o $sr_out tmp-sr || exit
+    gcc -w -Dint=long -Dcmul=ref_mul -Dcdiv=ref_div -xc -c -o tmp-ref.o tmp-sr
+    echo '
+    #include <limits.h>
+    #include <stdio.h>
+    long cmul(long, long), cdiv(long, long);
+    long ref_mul(long, long), ref_div(long, long);
+    int main() {
+        long xs[] = {0, 1, -1, 2, -2, 3, -3, 7, -7, 100, -100, LONG_MAX,
+                     LONG_MIN, LONG_MAX - 1, LONG_MIN + 1, INT_MAX, INT_MIN,
+                     1L << 32, -(1L << 32), (1L << 62) + 1};
+        int nxs = sizeof(xs) / sizeof(*xs);
+        unsigned long r = 88172645463325252UL;
+        for (int k = 0; k < 5000; k++) {
+            long x = xs[k % nxs];
+            if (k >= nxs) {
+                r ^= r << 13;
+                r ^= r >> 7;
+                r ^= r << 17;
+                x = (long)r >> (r % 64);
+            }
+            for (int i = 0; i < NMUL; i++)
+                if (cmul(x, i) != ref_mul(x, i)) {
+                    printf("mul #%d of %ld: %ld, expected %ld\n", i, x,
+                           cmul(x, i), ref_mul(x, i));
+                    return 1;
+                }
+            for (int i = 0; i < NDIV; i++) {
+                if (x == LONG_MIN && i == DIV_M1)
+                    continue;
+                if (cdiv(x, i) != ref_div(x, i)) {
+                    printf("div #%d of %ld: %ld, expected %ld\n", i, x,
+                           cdiv(x, i), ref_div(x, i));
+                    return 1;
+                }
+            }
+        }
+        return 0;
+    }' | gcc -DNMUL=$nmul -DNDIV=$ndiv -DDIV_M1=$div_m1 -xc -o tmp \
+        - -xnone $sr_out tmp-ref.o || exit
+    ./tmp || exit
+    echo "multiplication and division by constants => ok"
+    ;;
+esac
+
+# Several files compiled by one process. The inputs are not named *.c so
+# that the Makefile does not pick them up.
+echo 'int ret7() { return 7; }' > tmp-a
+echo 'int main() { return ret7(); }' > tmp-b
+./mcc -c -j 2 tmp-a tmp-b || exit
+cc -o tmp tmp-a.o tmp-b.o
+./tmp
+actual="$?"
+if [ "$actual" != 7 ]; then
+    echo "batch compilation => 7 expected, but got $actual"
+    exit 1
+fi
+
+# -emit-ir prints the CFG instead of assembly
+echo 'int main() { int x; x=1; if (x) return 2; return 3; }' |
+    ./mcc -emit-ir - > tmp.ir
+if ! grep -q '^    br v[0-9]*, bb1, bb2$' tmp.ir; then
+    echo "-emit-ir => br expected, but got"
+    cat tmp.ir
+    exit 1
+fi
+
+# Only locals whose address is taken are kept in memory
+echo 'int main() { int x; int y; x=1; y=2; return *&x+y; }' |
+    ./mcc -emit-ir - > tmp.ir
+if ! grep -q 'lvar x$' tmp.ir || grep -q 'lvar y$' tmp.ir; then
+    echo "-emit-ir => x in memory and y in a register expected, but got"
+    cat tmp.ir
+    exit 1
+fi
+
+# -fstats reports how often each peephole rule fired
+echo 'int main() { return add(3, 5); }' |
+    ./mcc -fno-regalloc -fstats -o tmp.s - 2> tmp.stats || exit
+if ! grep -q '^push-pop  *1$' tmp.stats ||
+    ! grep -q '^push-imm  *1$' tmp.stats; then
+    echo "-fstats => push-pop and push-imm expected, but got"
+    cat tmp.stats
+    exit 1
+fi
 
 echo OK
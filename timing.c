@@ -0,0 +1,159 @@
+#include "mcc.h"
+
+// Timing of compiler phases and functions for -ftime-report and --trace.
+//
+// Each measured interval is recorded as a span with its wall-clock and
+// CPU time. CPU time is that of the thread that ran the span, so the
+// work codegen hands to other threads appears in the function spans
+// rather than in the codegen phase.
+
+bool timing_enabled;
+
+typedef struct {
+    char *file;
+    char *cat; // "phase" or "function"
+    char *name;
+    int tid;
+    long start; // CLOCK_MONOTONIC in nanoseconds
+    long wall;
+    long cpu;
+} Span;
+
+static Span *spans;
+static int num_spans;
+static int cap_spans;
+static pthread_mutex_t spans_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static long epoch;
+static atomic_int next_tid = 1;
+static _Thread_local int tid;
+
+static long now(clockid_t clock) {
+    struct timespec ts;
+    clock_gettime(clock, &ts);
+    return ts.tv_sec * 1000000000L + ts.tv_nsec;
+}
+
+Timer timer_start(void) {
+    if (!timing_enabled)
+        return (Timer){};
+    return (Timer){now(CLOCK_MONOTONIC), now(CLOCK_THREAD_CPUTIME_ID)};
+}
+
+// Record the span from timer_start() until now
+void timer_stop(Timer *t, char *cat, char *name) {
+    if (!timing_enabled)
+        return;
+
+    long wall = now(CLOCK_MONOTONIC) - t->wall;
+    long cpu = now(CLOCK_THREAD_CPUTIME_ID) - t->cpu;
+
+    // Names of functions go away with their unit
+    name = strdup(name);
+    if (!tid)
+        tid = atomic_fetch_add(&next_tid, 1);
+
+    pthread_mutex_lock(&spans_lock);
+    if (!epoch || t->wall < epoch)
+        epoch = t->wall;
+    if (num_spans == cap_spans) {
+        cap_spans = cap_spans ? cap_spans * 2 : 256;
+        spans = realloc(spans, sizeof(Span) * cap_spans);
+        if (!spans)
+            error("out of memory");
+    }
+    spans[num_spans++] = (Span){tu ? tu->filename : "", cat, name, tid,
+                                t->wall, wall, cpu};
+    pthread_mutex_unlock(&spans_lock);
+}
+
+static int cmp_wall(const void *a, const void *b) {
+    long x = (*(Span **)a)->wall;
+    long y = (*(Span **)b)->wall;
+    return (x < y) - (x > y);
+}
+
+static void print_span(FILE *out, Span *s) {
+    fprintf(out, "  %-24s %10.3f %10.3f\n", s->name, s->wall / 1e6,
+            s->cpu / 1e6);
+}
+
+// Print the phases and functions of the current unit, slowest functions
+// first, followed by its statistics
+void print_time_report(FILE *out) {
+    pthread_mutex_lock(&spans_lock);
+
+    int n = 0;
+    Span **fns = calloc(num_spans, sizeof(Span *));
+    long wall = 0, cpu = 0;
+
+    fprintf(out, "time report for %s\n", tu->filename);
+    fprintf(out, "  %-24s %10s %10s\n", "phase", "wall ms", "cpu ms");
+    for (int i = 0; i < num_spans; i++) {
+        Span *s = &spans[i];
+        if (s->file != tu->filename)
+            continue;
+        if (!strcmp(s->cat, "phase")) {
+            print_span(out, s);
+            wall += s->wall;
+            cpu += s->cpu;
+        } else {
+            fns[n++] = s;
+        }
+    }
+    print_span(out, &(Span){.name = "total", .wall = wall, .cpu = cpu});
+
+    qsort(fns, n, sizeof(Span *), cmp_wall);
+    fprintf(out, "  %-24s %10s %10s\n", "function", "wall ms", "cpu ms");
+    for (int i = 0; i < n; i++)
+        print_span(out, fns[i]);
+    free(fns);
+
+    // The type arena holds nothing but types
+    struct rusage ru;
+    getrusage(RUSAGE_SELF, &ru);
+    fprintf(out, "  tokens %d, nodes %d, types %zu, objects %d\n",
+            tu->num_tokens, tu->num_nodes, tu->type_arena.objects,
+            tu->num_objs);
+    fprintf(out, "  peak RSS %ld KB\n", ru.ru_maxrss);
+
+    pthread_mutex_unlock(&spans_lock);
+}
+
+static void write_json_string(FILE *out, char *s) {
+    fputc('"', out);
+    for (; *s; s++) {
+        if (*s == '"' || *s == '\\')
+            fputc('\\', out);
+        if ((unsigned char)*s < 0x20)
+            fprintf(out, "\\u%04x", *s);
+        else
+            fputc(*s, out);
+    }
+    fputc('"', out);
+}
+
+// Write all spans as complete ("X") events in Chrome trace format.
+// Timestamps and durations are in microseconds.
+void write_trace(char *path) {
+    FILE *out = fopen(path, "w");
+    if (!out)
+        error("cannot open output file: %s: %s", path, strerror(errno));
+
+    fprintf(out, "{\"traceEvents\":[\n");
+    for (int i = 0; i < num_spans; i++) {
+        Span *s = &spans[i];
+        fprintf(out, "{\"name\":");
+        write_json_string(out, s->name);
+        fprintf(out, ",\"cat\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%d,",
+                s->cat, s->tid);
+        fprintf(out, "\"ts\":%.3f,\"dur\":%.3f,", (s->start - epoch) / 1e3,
+                s->wall / 1e3);
+        fprintf(out, "\"args\":{\"file\":");
+        write_json_string(out, s->file);
+        fprintf(out, ",\"cpu_us\":%.3f}}%s\n", s->cpu / 1e3,
+                i + 1 < num_spans ? "," : "");
+    }
+    fprintf(out, "]}\n");
+    fclose(out);
+}
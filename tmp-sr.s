@@ -0,0 +1,2721 @@
+.intel_syntax noprefix
+    .globl cdiv
+    .text
+cdiv:
+    push rbp
+    mov rbp, rsp
+    sub rsp, 0
+.L.bb.cdiv.0:
+    mov rcx, rdi
+    cmp rsi, 0
+    jne .L.bb.cdiv.2
+.L.bb.cdiv.1:
+    mov rax, rcx
+    jmp .L.return.cdiv
+.L.bb.cdiv.3:
+.L.bb.cdiv.2:
+    cmp rsi, 1
+    jne .L.bb.cdiv.5
+.L.bb.cdiv.4:
+    mov rdi, rcx
+    neg rdi
+    mov rax, rdi
+    jmp .L.return.cdiv
+.L.bb.cdiv.6:
+.L.bb.cdiv.5:
+    cmp rsi, 2
+    jne .L.bb.cdiv.8
+.L.bb.cdiv.7:
+    mov rdi, rcx
+    sar rdi, 63
+    shr rdi, 63
+    add rdi, rcx
+    sar rdi, 1
+    mov rax, rdi
+    jmp .L.return.cdiv
+.L.bb.cdiv.9:
+.L.bb.cdiv.8:
+    cmp rsi, 3
+    jne .L.bb.cdiv.11
+.L.bb.cdiv.10:
+    mov rdi, rcx
+    sar rdi, 63
+    shr rdi, 63
+    add rdi, rcx
+    sar rdi, 1
+    neg rdi
+    mov rax, rdi
+    jmp .L.return.cdiv
+.L.bb.cdiv.12:
+.L.bb.cdiv.11:
+    cmp rsi, 4
+    jne .L.bb.cdiv.14
+.L.bb.cdiv.13:
+    mov rax, 6148914691236517206
+    imul rcx
+    mov rdi, rdx
+    shr rdi, 63
+    add rdi, rdx
+    mov rax, rdi
+    jmp .L.return.cdiv
+.L.bb.cdiv.15:
+.L.bb.cdiv.14:
+    cmp rsi, 5
+    jne .L.bb.cdiv.17
+.L.bb.cdiv.16:
+    mov rax, 6148914691236517205
+    imul rcx
+    sub rdx, rcx
+    sar rdx, 1
+    mov rdi, rdx
+    shr rdi, 63
+    add rdi, rdx
+    mov rax, rdi
+    jmp .L.return.cdiv
+.L.bb.cdiv.18:
+.L.bb.cdiv.17:
+    cmp rsi, 6
+    jne .L.bb.cdiv.20
+.L.bb.cdiv.19:
+    mov rdi, rcx
+    sar rdi, 63
+    shr rdi, 62
+    add rdi, rcx
+    sar rdi, 2
+    mov rax, rdi
+    jmp .L.return.cdiv
+.L.bb.cdiv.21:
+.L.bb.cdiv.20:
+    cmp rsi, 7
+    jne .L.bb.cdiv.23
+.L.bb.cdiv.22:
+    mov rdi, rcx
+    sar rdi, 63
+    shr rdi, 62
+    add rdi, rcx
+    sar rdi, 2
+    neg rdi
+    mov rax, rdi
+    jmp .L.return.cdiv
+.L.bb.cdiv.24:
+.L.bb.cdiv.23:
+    cmp rsi, 8
+    jne .L.bb.cdiv.26
+.L.bb.cdiv.25:
+    mov rax, 7378697629483820647
+    imul rcx
+    sar rdx, 1
+    mov rdi, rdx
+    shr rdi, 63
+    add rdi, rdx
+    mov rax, rdi
+    jmp .L.return.cdiv
+.L.bb.cdiv.27:
+.L.bb.cdiv.26:
+    cmp rsi, 9
+    jne .L.bb.cdiv.29
+.L.bb.cdiv.28:
+    mov rax, -7378697629483820647
+    imul rcx
+    sar rdx, 1
+    mov rdi, rdx
+    shr rdi, 63
+    add rdi, rdx
+    mov rax, rdi
+    jmp .L.return.cdiv
+.L.bb.cdiv.30:
+.L.bb.cdiv.29:
+    cmp rsi, 10
+    jne .L.bb.cdiv.32
+.L.bb.cdiv.31:
+    mov rax, 3074457345618258603
+    imul rcx
+    mov rdi, rdx
+    shr rdi, 63
+    add rdi, rdx
+    mov rax, rdi
+    jmp .L.return.cdiv
+.L.bb.cdiv.33:
+.L.bb.cdiv.32:
+    cmp rsi, 11
+    jne .L.bb.cdiv.35
+.L.bb.cdiv.34:
+    mov rax, -3074457345618258603
+    imul rcx
+    mov rdi, rdx
+    shr rdi, 63
+    add rdi, rdx
+    mov rax, rdi
+    jmp .L.return.cdiv
+.L.bb.cdiv.36:
+.L.bb.cdiv.35:
+    cmp rsi, 12
+    jne .L.bb.cdiv.38
+.L.bb.cdiv.37:
+    mov rax, 5270498306774157605
+    imul rcx
+    sar rdx, 1
+    mov rdi, rdx
+    shr rdi, 63
+    add rdi, rdx
+    mov rax, rdi
+    jmp .L.return.cdiv
+.L.bb.cdiv.39:
+.L.bb.cdiv.38:
+    cmp rsi, 13
+    jne .L.bb.cdiv.41
+.L.bb.cdiv.40:
+    mov rax, -5270498306774157605
+    imul rcx
+    sar rdx, 1
+    mov rdi, rdx
+    shr rdi, 63
+    add rdi, rdx
+    mov rax, rdi
+    jmp .L.return.cdiv
+.L.bb.cdiv.42:
+.L.bb.cdiv.41:
+    cmp rsi, 14
+    jne .L.bb.cdiv.44
+.L.bb.cdiv.43:
+    mov rdi, rcx
+    sar rdi, 63
+    shr rdi, 61
+    add rdi, rcx
+    sar rdi, 3
+    mov rax, rdi
+    jmp .L.return.cdiv
+.L.bb.cdiv.45:
+.L.bb.cdiv.44:
+    cmp rsi, 15
+    jne .L.bb.cdiv.47
+.L.bb.cdiv.46:
+    mov rdi, rcx
+    sar rdi, 63
+    shr rdi, 61
+    add rdi, rcx
+    sar rdi, 3
+    neg rdi
+    mov rax, rdi
+    jmp .L.return.cdiv
+.L.bb.cdiv.48:
+.L.bb.cdiv.47:
+    cmp rsi, 16
+    jne .L.bb.cdiv.50
+.L.bb.cdiv.49:
+    mov rax, 2049638230412172402
+    imul rcx
+    mov rdi, rdx
+    shr rdi, 63
+    add rdi, rdx
+    mov rax, rdi
+    jmp .L.return.cdiv
+.L.bb.cdiv.51:
+.L.bb.cdiv.50:
+    cmp rsi, 17
+    jne .L.bb.cdiv.53
+.L.bb.cdiv.52:
+    mov rax, 2049638230412172401
+    imul rcx
+    sub rdx, rcx
+    sar rdx, 3
+    mov rdi, rdx
+    shr rdi, 63
+    add rdi, rdx
+    mov rax, rdi
+    jmp .L.return.cdiv
+.L.bb.cdiv.54:
+.L.bb.cdiv.53:
+    cmp rsi, 18
+    jne .L.bb.cdiv.56
+.L.bb.cdiv.55:
+    mov rax, 7378697629483820647
+    imul rcx
+    sar rdx, 2
+    mov rdi, rdx
+    shr rdi, 63
+    add rdi, rdx
+    mov rax, rdi
+    jmp .L.return.cdiv
+.L.bb.cdiv.57:
+.L.bb.cdiv.56:
+    cmp rsi, 19
+    jne .L.bb.cdiv.59
+.L.bb.cdiv.58:
+    mov rax, -7378697629483820647
+    imul rcx
+    sar rdx, 2
+    mov rdi, rdx
+    shr rdi, 63
+    add rdi, rdx
+    mov rax, rdi
+    jmp .L.return.cdiv
+.L.bb.cdiv.60:
+.L.bb.cdiv.59:
+    cmp rsi, 20
+    jne .L.bb.cdiv.62
+.L.bb.cdiv.61:
+    mov rax, 3353953467947191203
+    imul rcx
+    sar rdx, 1
+    mov rdi, rdx
+    shr rdi, 63
+    add rdi, rdx
+    mov rax, rdi
+    jmp .L.return.cdiv
+.L.bb.cdiv.63:
+.L.bb.cdiv.62:
+    cmp rsi, 21
+    jne .L.bb.cdiv.65
+.L.bb.cdiv.64:
+    mov rax, -3353953467947191203
+    imul rcx
+    sar rdx, 1
+    mov rdi, rdx
+    shr rdi, 63
+    add rdi, rdx
+    mov rax, rdi
+    jmp .L.return.cdiv
+.L.bb.cdiv.66:
+.L.bb.cdiv.65:
+    cmp rsi, 22
+    jne .L.bb.cdiv.68
+.L.bb.cdiv.67:
+    mov rax, 3074457345618258603
+    imul rcx
+    sar rdx, 1
+    mov rdi, rdx
+    shr rdi, 63
+    add rdi, rdx
+    mov rax, rdi
+    jmp .L.return.cdiv
+.L.bb.cdiv.69:
+.L.bb.cdiv.68:
+    cmp rsi, 23
+    jne .L.bb.cdiv.71
+.L.bb.cdiv.70:
+    mov rax, -3074457345618258603
+    imul rcx
+    sar rdx, 1
+    mov rdi, rdx
+    shr rdi, 63
+    add rdi, rdx
+    mov rax, rdi
+    jmp .L.return.cdiv
+.L.bb.cdiv.72:
+.L.bb.cdiv.71:
+    cmp rsi, 24
+    jne .L.bb.cdiv.74
+.L.bb.cdiv.73:
+    mov rax, 5675921253449092805
+    imul rcx
+    sar rdx, 2
+    mov rdi, rdx
+    shr rdi, 63
+    add rdi, rdx
+    mov rax, rdi
+    jmp .L.return.cdiv
+.L.bb.cdiv.75:
+.L.bb.cdiv.74:
+    cmp rsi, 25
+    jne .L.bb.cdiv.77
+.L.bb.cdiv.76:
+    mov rax, -5675921253449092805
+    imul rcx
+    sar rdx, 2
+    mov rdi, rdx
+    shr rdi, 63
+    add rdi, rdx
+    mov rax, rdi
+    jmp .L.return.cdiv
+.L.bb.cdiv.78:
+.L.bb.cdiv.77:
+    cmp rsi, 26
+    jne .L.bb.cdiv.80
+.L.bb.cdiv.79:
+    mov rax, -8608480567731124087
+    imul rcx
+    add rdx, rcx
+    sar rdx, 3
+    mov rdi, rdx
+    shr rdi, 63
+    add rdi, rdx
+    mov rax, rdi
+    jmp .L.return.cdiv
+.L.bb.cdiv.81:
+.L.bb.cdiv.80:
+    cmp rsi, 27
+    jne .L.bb.cdiv.83
+.L.bb.cdiv.82:
+    mov rax, 8608480567731124087
+    imul rcx
+    sub rdx, rcx
+    sar rdx, 3
+    mov rdi, rdx
+    shr rdi, 63
+    add rdi, rdx
+    mov rax, rdi
+    jmp .L.return.cdiv
+.L.bb.cdiv.84:
+.L.bb.cdiv.83:
+    cmp rsi, 28
+    jne .L.bb.cdiv.86
+.L.bb.cdiv.85:
+    mov rdi, rcx
+    sar rdi, 63
+    shr rdi, 60
+    add rdi, rcx
+    sar rdi, 4
+    mov rax, rdi
+    jmp .L.return.cdiv
+.L.bb.cdiv.87:
+.L.bb.cdiv.86:
+    cmp rsi, 29
+    jne .L.bb.cdiv.89
+.L.bb.cdiv.88:
+    mov rdi, rcx
+    sar rdi, 63
+    shr rdi, 60
+    add rdi, rcx
+    sar rdi, 4
+    neg rdi
+    mov rax, rdi
+    jmp .L.return.cdiv
+.L.bb.cdiv.90:
+.L.bb.cdiv.89:
+    cmp rsi, 30
+    jne .L.bb.cdiv.92
+.L.bb.cdiv.91:
+    mov rax, 8680820740569200761
+    imul rcx
+    sar rdx, 3
+    mov rdi, rdx
+    shr rdi, 63
+    add rdi, rdx
+    mov rax, rdi
+    jmp .L.return.cdiv
+.L.bb.cdiv.93:
+.L.bb.cdiv.92:
+    cmp rsi, 31
+    jne .L.bb.cdiv.95
+.L.bb.cdiv.94:
+    mov rax, -8680820740569200761
+    imul rcx
+    sar rdx, 3
+    mov rdi, rdx
+    shr rdi, 63
+    add rdi, rdx
+    mov rax, rdi
+    jmp .L.return.cdiv
+.L.bb.cdiv.96:
+.L.bb.cdiv.95:
+    cmp rsi, 32
+    jne .L.bb.cdiv.98
+.L.bb.cdiv.97:
+    mov rax, 3074457345618258603
+    imul rcx
+    sar rdx, 2
+    mov rdi, rdx
+    shr rdi, 63
+    add rdi, rdx
+    mov rax, rdi
+    jmp .L.return.cdiv
+.L.bb.cdiv.99:
+.L.bb.cdiv.98:
+    cmp rsi, 33
+    jne .L.bb.cdiv.101
+.L.bb.cdiv.100:
+    mov rax, -3074457345618258603
+    imul rcx
+    sar rdx, 2
+    mov rdi, rdx
+    shr rdi, 63
+    add rdi, rdx
+    mov rax, rdi
+    jmp .L.return.cdiv
+.L.bb.cdiv.102:
+.L.bb.cdiv.101:
+    cmp rsi, 34
+    jne .L.bb.cdiv.104
+.L.bb.cdiv.103:
+    mov rax, -6640827866535438581
+    imul rcx
+    add rdx, rcx
+    sar rdx, 4
+    mov rdi, rdx
+    shr rdi, 63
+    add rdi, rdx
+    mov rax, rdi
+    jmp .L.return.cdiv
+.L.bb.cdiv.105:
+.L.bb.cdiv.104:
+    cmp rsi, 35
+    jne .L.bb.cdiv.107
+.L.bb.cdiv.106:
+    mov rax, 6640827866535438581
+    imul rcx
+    sub rdx, rcx
+    sar rdx, 4
+    mov rdi, rdx
+    shr rdi, 63
+    add rdi, rdx
+    mov rax, rdi
+    jmp .L.return.cdiv
+.L.bb.cdiv.108:
+.L.bb.cdiv.107:
+    cmp rsi, 36
+    jne .L.bb.cdiv.110
+.L.bb.cdiv.109:
+    mov rax, -8925843906633654007
+    imul rcx
+    add rdx, rcx
+    sar rdx, 4
+    mov rdi, rdx
+    shr rdi, 63
+    add rdi, rdx
+    mov rax, rdi
+    jmp .L.return.cdiv
+.L.bb.cdiv.111:
+.L.bb.cdiv.110:
+    cmp rsi, 37
+    jne .L.bb.cdiv.113
+.L.bb.cdiv.112:
+    mov rax, 8925843906633654007
+    imul rcx
+    sub rdx, rcx
+    sar rdx, 4
+    mov rdi, rdx
+    shr rdi, 63
+    add rdi, rdx
+    mov rax, rdi
+    jmp .L.return.cdiv
+.L.bb.cdiv.114:
+.L.bb.cdiv.113:
+    cmp rsi, 38
+    jne .L.bb.cdiv.116
+.L.bb.cdiv.115:
+    mov rdi, rcx
+    sar rdi, 63
+    shr rdi, 59
+    add rdi, rcx
+    sar rdi, 5
+    mov rax, rdi
+    jmp .L.return.cdiv
+.L.bb.cdiv.117:
+.L.bb.cdiv.116:
+    cmp rsi, 39
+    jne .L.bb.cdiv.119
+.L.bb.cdiv.118:
+    mov rdi, rcx
+    sar rdi, 63
+    shr rdi, 59
+    add rdi, rcx
+    sar rdi, 5
+    neg rdi
+    mov rax, rdi
+    jmp .L.return.cdiv
+.L.bb.cdiv.120:
+.L.bb.cdiv.119:
+    cmp rsi, 40
+    jne .L.bb.cdiv.122
+.L.bb.cdiv.121:
+    mov rax, 1024819115206086201
+    imul rcx
+    sar rdx, 1
+    mov rdi, rdx
+    shr rdi, 63
+    add rdi, rdx
+    mov rax, rdi
+    jmp .L.return.cdiv
+.L.bb.cdiv.123:
+.L.bb.cdiv.122:
+    cmp rsi, 41
+    jne .L.bb.cdiv.125
+.L.bb.cdiv.124:
+    mov rax, -1024819115206086201
+    imul rcx
+    sar rdx, 1
+    mov rdi, rdx
+    shr rdi, 63
+    add rdi, rdx
+    mov rax, rdi
+    jmp .L.return.cdiv
+.L.bb.cdiv.126:
+.L.bb.cdiv.125:
+    cmp rsi, 42
+    jne .L.bb.cdiv.128
+.L.bb.cdiv.127:
+    mov rax, 7378697629483820647
+    imul rcx
+    sar rdx, 4
+    mov rdi, rdx
+    shr rdi, 63
+    add rdi, rdx
+    mov rax, rdi
+    jmp .L.return.cdiv
+.L.bb.cdiv.129:
+.L.bb.cdiv.128:
+    cmp rsi, 43
+    jne .L.bb.cdiv.131
+.L.bb.cdiv.130:
+    mov rax, -7378697629483820647
+    imul rcx
+    sar rdx, 4
+    mov rdi, rdx
+    shr rdi, 63
+    add rdi, rdx
+    mov rax, rdi
+    jmp .L.return.cdiv
+.L.bb.cdiv.132:
+.L.bb.cdiv.131:
+    cmp rsi, 44
+    jne .L.bb.cdiv.134
+.L.bb.cdiv.133:
+    mov rax, 3279421168659475843
+    imul rcx
+    sar rdx, 3
+    mov rdi, rdx
+    shr rdi, 63
+    add rdi, rdx
+    mov rax, rdi
+    jmp .L.return.cdiv
+.L.bb.cdiv.135:
+.L.bb.cdiv.134:
+    cmp rsi, 45
+    jne .L.bb.cdiv.137
+.L.bb.cdiv.136:
+    mov rax, -3279421168659475843
+    imul rcx
+    sar rdx, 3
+    mov rdi, rdx
+    shr rdi, 63
+    add rdi, rdx
+    mov rax, rdi
+    jmp .L.return.cdiv
+.L.bb.cdiv.138:
+.L.bb.cdiv.137:
+    cmp rsi, 46
+    jne .L.bb.cdiv.140
+.L.bb.cdiv.139:
+    mov rax, -9076969306111049207
+    imul rcx
+    add rdx, rcx
+    sar rdx, 5
+    mov rdi, rdx
+    shr rdi, 63
+    add rdi, rdx
+    mov rax, rdi
+    jmp .L.return.cdiv
+.L.bb.cdiv.141:
+.L.bb.cdiv.140:
+    cmp rsi, 47
+    jne .L.bb.cdiv.143
+.L.bb.cdiv.142:
+    mov rax, 9076969306111049207
+    imul rcx
+    sub rdx, rcx
+    sar rdx, 5
+    mov rdi, rdx
+    shr rdi, 63
+    add rdi, rdx
+    mov rax, rdi
+    jmp .L.return.cdiv
+.L.bb.cdiv.144:
+.L.bb.cdiv.143:
+    cmp rsi, 48
+    jne .L.bb.cdiv.146
+.L.bb.cdiv.145:
+    mov rdi, rcx
+    sar rdi, 63
+    shr rdi, 58
+    add rdi, rcx
+    sar rdi, 6
+    mov rax, rdi
+    jmp .L.return.cdiv
+.L.bb.cdiv.147:
+.L.bb.cdiv.146:
+    cmp rsi, 49
+    jne .L.bb.cdiv.149
+.L.bb.cdiv.148:
+    mov rdi, rcx
+    sar rdi, 63
+    shr rdi, 58
+    add rdi, rcx
+    sar rdi, 6
+    neg rdi
+    mov rax, rdi
+    jmp .L.return.cdiv
+.L.bb.cdiv.150:
+.L.bb.cdiv.149:
+    cmp rsi, 50
+    jne .L.bb.cdiv.152
+.L.bb.cdiv.151:
+    mov rax, 1024819115206086201
+    imul rcx
+    sar rdx, 2
+    mov rdi, rdx
+    shr rdi, 63
+    add rdi, rdx
+    mov rax, rdi
+    jmp .L.return.cdiv
+.L.bb.cdiv.153:
+.L.bb.cdiv.152:
+    cmp rsi, 51
+    jne .L.bb.cdiv.155
+.L.bb.cdiv.154:
+    mov rax, -1024819115206086201
+    imul rcx
+    sar rdx, 2
+    mov rdi, rdx
+    shr rdi, 63
+    add rdi, rdx
+    mov rax, rdi
+    jmp .L.return.cdiv
+.L.bb.cdiv.156:
+.L.bb.cdiv.155:
+    cmp rsi, 52
+    jne .L.bb.cdiv.158
+.L.bb.cdiv.157:
+    mov rax, -6640827866535438581
+    imul rcx
+    add rdx, rcx
+    sar rdx, 6
+    mov rdi, rdx
+    shr rdi, 63
+    add rdi, rdx
+    mov rax, rdi
+    jmp .L.return.cdiv
+.L.bb.cdiv.159:
+.L.bb.cdiv.158:
+    cmp rsi, 53
+    jne .L.bb.cdiv.161
+.L.bb.cdiv.160:
+    mov rax, 6640827866535438581
+    imul rcx
+    sub rdx, rcx
+    sar rdx, 6
+    mov rdi, rdx
+    shr rdi, 63
+    add rdi, rdx
+    mov rax, rdi
+    jmp .L.return.cdiv
+.L.bb.cdiv.162:
+.L.bb.cdiv.161:
+    cmp rsi, 54
+    jne .L.bb.cdiv.164
+.L.bb.cdiv.163:
+    mov rax, 4647998506761461825
+    imul rcx
+    sar rdx, 5
+    mov rdi, rdx
+    shr rdi, 63
+    add rdi, rdx
+    mov rax, rdi
+    jmp .L.return.cdiv
+.L.bb.cdiv.165:
+.L.bb.cdiv.164:
+    cmp rsi, 55
+    jne .L.bb.cdiv.167
+.L.bb.cdiv.166:
+    mov rax, -4647998506761461825
+    imul rcx
+    sar rdx, 5
+    mov rdi, rdx
+    shr rdi, 63
+    add rdi, rdx
+    mov rax, rdi
+    jmp .L.return.cdiv
+.L.bb.cdiv.168:
+.L.bb.cdiv.167:
+    cmp rsi, 56
+    jne .L.bb.cdiv.170
+.L.bb.cdiv.169:
+    mov rdi, rcx
+    sar rdi, 63
+    shr rdi, 57
+    add rdi, rcx
+    sar rdi, 7
+    mov rax, rdi
+    jmp .L.return.cdiv
+.L.bb.cdiv.171:
+.L.bb.cdiv.170:
+    cmp rsi, 57
+    jne .L.bb.cdiv.173
+.L.bb.cdiv.172:
+    mov rdi, rcx
+    sar rdi, 63
+    shr rdi, 57
+    add rdi, rcx
+    sar rdi, 7
+    neg rdi
+    mov rax, rdi
+    jmp .L.return.cdiv
+.L.bb.cdiv.174:
+.L.bb.cdiv.173:
+    cmp rsi, 58
+    jne .L.bb.cdiv.176
+.L.bb.cdiv.175:
+    mov rax, -9187201950435737471
+    imul rcx
+    add rdx, rcx
+    sar rdx, 7
+    mov rdi, rdx
+    shr rdi, 63
+    add rdi, rdx
+    mov rax, rdi
+    jmp .L.return.cdiv
+.L.bb.cdiv.177:
+.L.bb.cdiv.176:
+    cmp rsi, 59
+    jne .L.bb.cdiv.179
+.L.bb.cdiv.178:
+    mov rax, 9187201950435737471
+    imul rcx
+    sub rdx, rcx
+    sar rdx, 7
+    mov rdi, rdx
+    shr rdi, 63
+    add rdi, rdx
+    mov rax, rdi
+    jmp .L.return.cdiv
+.L.bb.cdiv.180:
+.L.bb.cdiv.179:
+    cmp rsi, 60
+    jne .L.bb.cdiv.182
+.L.bb.cdiv.181:
+    mov rax, 7367186400732675841
+    imul rcx
+    sar rdx, 8
+    mov rdi, rdx
+    shr rdi, 63
+    add rdi, rdx
+    mov rax, rdi
+    jmp .L.return.cdiv
+.L.bb.cdiv.183:
+.L.bb.cdiv.182:
+    cmp rsi, 61
+    jne .L.bb.cdiv.185
+.L.bb.cdiv.184:
+    mov rax, -7367186400732675841
+    imul rcx
+    sar rdx, 8
+    mov rdi, rdx
+    shr rdi, 63
+    add rdi, rdx
+    mov rax, rdi
+    jmp .L.return.cdiv
+.L.bb.cdiv.186:
+.L.bb.cdiv.185:
+    cmp rsi, 62
+    jne .L.bb.cdiv.188
+.L.bb.cdiv.187:
+    mov rax, 2361183241434822607
+    imul rcx
+    sar rdx, 7
+    mov rdi, rdx
+    shr rdi, 63
+    add rdi, rdx
+    mov rax, rdi
+    jmp .L.return.cdiv
+.L.bb.cdiv.189:
+.L.bb.cdiv.188:
+    cmp rsi, 63
+    jne .L.bb.cdiv.191
+.L.bb.cdiv.190:
+    mov rax, -2361183241434822607
+    imul rcx
+    sar rdx, 7
+    mov rdi, rdx
+    shr rdi, 63
+    add rdi, rdx
+    mov rax, rdi
+    jmp .L.return.cdiv
+.L.bb.cdiv.192:
+.L.bb.cdiv.191:
+    cmp rsi, 64
+    jne .L.bb.cdiv.194
+.L.bb.cdiv.193:
+    mov rdi, rcx
+    sar rdi, 63
+    shr rdi, 52
+    add rdi, rcx
+    sar rdi, 12
+    mov rax, rdi
+    jmp .L.return.cdiv
+.L.bb.cdiv.195:
+.L.bb.cdiv.194:
+    cmp rsi, 65
+    jne .L.bb.cdiv.197
+.L.bb.cdiv.196:
+    mov rdi, rcx
+    sar rdi, 63
+    shr rdi, 52
+    add rdi, rcx
+    sar rdi, 12
+    neg rdi
+    mov rax, rdi
+    jmp .L.return.cdiv
+.L.bb.cdiv.198:
+.L.bb.cdiv.197:
+    cmp rsi, 66
+    jne .L.bb.cdiv.200
+.L.bb.cdiv.199:
+    mov rax, 9223231301513871361
+    imul rcx
+    sar rdx, 15
+    mov rdi, rdx
+    shr rdi, 63
+    add rdi, rdx
+    mov rax, rdi
+    jmp .L.return.cdiv
+.L.bb.cdiv.201:
+.L.bb.cdiv.200:
+    cmp rsi, 67
+    jne .L.bb.cdiv.203
+.L.bb.cdiv.202:
+    mov rax, -9223231301513871361
+    imul rcx
+    sar rdx, 15
+    mov rdi, rdx
+    shr rdi, 63
+    add rdi, rdx
+    mov rax, rdi
+    jmp .L.return.cdiv
+.L.bb.cdiv.204:
+.L.bb.cdiv.203:
+    cmp rsi, 68
+    jne .L.bb.cdiv.206
+.L.bb.cdiv.205:
+    mov rax, -6899514631820148735
+    imul rcx
+    add rdx, rcx
+    sar rdx, 22
+    mov rdi, rdx
+    shr rdi, 63
+    add rdi, rdx
+    mov rax, rdi
+    jmp .L.return.cdiv
+.L.bb.cdiv.207:
+.L.bb.cdiv.206:
+    cmp rsi, 69
+    jne .L.bb.cdiv.209
+.L.bb.cdiv.208:
+    mov rax, 6899514631820148735
+    imul rcx
+    sub rdx, rcx
+    sar rdx, 22
+    mov rdi, rdx
+    shr rdi, 63
+    add rdi, rdx
+    mov rax, rdi
+    jmp .L.return.cdiv
+.L.bb.cdiv.210:
+.L.bb.cdiv.209:
+    cmp rsi, 70
+    jne .L.bb.cdiv.212
+.L.bb.cdiv.211:
+    mov rax, -8543223828751151131
+    imul rcx
+    add rdx, rcx
+    sar rdx, 29
+    mov rdi, rdx
+    shr rdi, 63
+    add rdi, rdx
+    mov rax, rdi
+    jmp .L.return.cdiv
+.L.bb.cdiv.213:
+.L.bb.cdiv.212:
+    cmp rsi, 71
+    jne .L.bb.cdiv.215
+.L.bb.cdiv.214:
+    mov rax, 8543223828751151131
+    imul rcx
+    sub rdx, rcx
+    sar rdx, 29
+    mov rdi, rdx
+    shr rdi, 63
+    add rdi, rdx
+    mov rax, rdi
+    jmp .L.return.cdiv
+.L.bb.cdiv.216:
+.L.bb.cdiv.215:
+    cmp rsi, 72
+    jne .L.bb.cdiv.218
+.L.bb.cdiv.217:
+    mov rax, -9223372032559808509
+    imul rcx
+    add rdx, rcx
+    sar rdx, 30
+    mov rdi, rdx
+    shr rdi, 63
+    add rdi, rdx
+    mov rax, rdi
+    jmp .L.return.cdiv
+.L.bb.cdiv.219:
+.L.bb.cdiv.218:
+    cmp rsi, 73
+    jne .L.bb.cdiv.221
+.L.bb.cdiv.220:
+    mov rax, 9223372032559808509
+    imul rcx
+    sub rdx, rcx
+    sar rdx, 30
+    mov rdi, rdx
+    shr rdi, 63
+    add rdi, rdx
+    mov rax, rdi
+    jmp .L.return.cdiv
+.L.bb.cdiv.222:
+.L.bb.cdiv.221:
+    cmp rsi, 74
+    jne .L.bb.cdiv.224
+.L.bb.cdiv.223:
+    mov rdi, rcx
+    sar rdi, 63
+    shr rdi, 33
+    add rdi, rcx
+    sar rdi, 31
+    mov rax, rdi
+    jmp .L.return.cdiv
+.L.bb.cdiv.225:
+.L.bb.cdiv.224:
+    cmp rsi, 75
+    jne .L.bb.cdiv.227
+.L.bb.cdiv.226:
+    mov rdi, rcx
+    sar rdi, 63
+    shr rdi, 33
+    add rdi, rcx
+    sar rdi, 31
+    neg rdi
+    mov rax, rdi
+    jmp .L.return.cdiv
+.L.bb.cdiv.228:
+.L.bb.cdiv.227:
+    cmp rsi, 76
+    jne .L.bb.cdiv.230
+.L.bb.cdiv.229:
+    mov rdi, rcx
+    sar rdi, 63
+    shr rdi, 32
+    add rdi, rcx
+    sar rdi, 32
+    mov rax, rdi
+    jmp .L.return.cdiv
+.L.bb.cdiv.231:
+.L.bb.cdiv.230:
+    cmp rsi, 77
+    jne .L.bb.cdiv.233
+.L.bb.cdiv.232:
+    mov rdi, rcx
+    sar rdi, 63
+    shr rdi, 32
+    add rdi, rcx
+    sar rdi, 32
+    neg rdi
+    mov rax, rdi
+    jmp .L.return.cdiv
+.L.bb.cdiv.234:
+.L.bb.cdiv.233:
+    cmp rsi, 78
+    jne .L.bb.cdiv.236
+.L.bb.cdiv.235:
+    mov rdi, rcx
+    sar rdi, 63
+    shr rdi, 24
+    add rdi, rcx
+    sar rdi, 40
+    mov rax, rdi
+    jmp .L.return.cdiv
+.L.bb.cdiv.237:
+.L.bb.cdiv.236:
+    cmp rsi, 79
+    jne .L.bb.cdiv.239
+.L.bb.cdiv.238:
+    mov rdi, rcx
+    sar rdi, 63
+    shr rdi, 24
+    add rdi, rcx
+    sar rdi, 40
+    neg rdi
+    mov rax, rdi
+    jmp .L.return.cdiv
+.L.bb.cdiv.240:
+.L.bb.cdiv.239:
+    cmp rsi, 80
+    jne .L.bb.cdiv.242
+.L.bb.cdiv.241:
+    mov rdi, rcx
+    sar rdi, 63
+    shr rdi, 2
+    add rdi, rcx
+    sar rdi, 62
+    mov rax, rdi
+    jmp .L.return.cdiv
+.L.bb.cdiv.243:
+.L.bb.cdiv.242:
+    cmp rsi, 81
+    jne .L.bb.cdiv.245
+.L.bb.cdiv.244:
+    mov rdi, rcx
+    sar rdi, 63
+    shr rdi, 2
+    add rdi, rcx
+    sar rdi, 62
+    neg rdi
+    mov rax, rdi
+    jmp .L.return.cdiv
+.L.bb.cdiv.246:
+.L.bb.cdiv.245:
+    cmp rsi, 82
+    jne .L.bb.cdiv.248
+.L.bb.cdiv.247:
+    mov rax, 4611686018427387905
+    imul rcx
+    sar rdx, 61
+    mov rdi, rdx
+    shr rdi, 63
+    add rdi, rdx
+    mov rax, rdi
+    jmp .L.return.cdiv
+.L.bb.cdiv.249:
+.L.bb.cdiv.248:
+    cmp rsi, 83
+    jne .L.bb.cdiv.251
+.L.bb.cdiv.250:
+    mov rax, -4611686018427387905
+    imul rcx
+    sar rdx, 61
+    mov rdi, rdx
+    shr rdi, 63
+    add rdi, rdx
+    mov rax, rdi
+    jmp .L.return.cdiv
+.L.bb.cdiv.252:
+.L.bb.cdiv.251:
+    cmp rsi, 84
+    jne .L.bb.cdiv.254
+.L.bb.cdiv.253:
+    mov rdi, -9223372036854775808
+    mov rax, rcx
+    cqo
+    idiv rdi
+    mov rdi, rax
+    mov rax, rdi
+    jmp .L.return.cdiv
+.L.bb.cdiv.255:
+.L.bb.cdiv.254:
+    cmp rsi, 85
+    jne .L.bb.cdiv.257
+.L.bb.cdiv.256:
+    mov rsi, -9223372036854775808
+    mov rax, rcx
+    cqo
+    idiv rsi
+    mov rcx, rax
+    mov rax, rcx
+    jmp .L.return.cdiv
+.L.bb.cdiv.258:
+.L.bb.cdiv.257:
+    mov rax, 0
+.L.return.cdiv:
+    mov rsp, rbp
+    pop rbp
+    ret
+    .globl cmul
+    .text
+cmul:
+    push rbp
+    mov rbp, rsp
+    sub rsp, 0
+.L.bb.cmul.0:
+    mov rcx, rdi
+    cmp rsi, 0
+    jne .L.bb.cmul.2
+.L.bb.cmul.1:
+    mov rax, 0
+    jmp .L.return.cmul
+.L.bb.cmul.3:
+.L.bb.cmul.2:
+    cmp rsi, 1
+    jne .L.bb.cmul.5
+.L.bb.cmul.4:
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.6:
+.L.bb.cmul.5:
+    cmp rsi, 2
+    jne .L.bb.cmul.8
+.L.bb.cmul.7:
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.9:
+.L.bb.cmul.8:
+    cmp rsi, 3
+    jne .L.bb.cmul.11
+.L.bb.cmul.10:
+    mov rdi, rcx
+    neg rdi
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.12:
+.L.bb.cmul.11:
+    cmp rsi, 4
+    jne .L.bb.cmul.14
+.L.bb.cmul.13:
+    mov rdi, rcx
+    neg rdi
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.15:
+.L.bb.cmul.14:
+    cmp rsi, 5
+    jne .L.bb.cmul.17
+.L.bb.cmul.16:
+    mov rdi, rcx
+    shl rdi, 1
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.18:
+.L.bb.cmul.17:
+    cmp rsi, 6
+    jne .L.bb.cmul.20
+.L.bb.cmul.19:
+    mov rdi, rcx
+    shl rdi, 1
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.21:
+.L.bb.cmul.20:
+    cmp rsi, 7
+    jne .L.bb.cmul.23
+.L.bb.cmul.22:
+    mov rdi, rcx
+    shl rdi, 1
+    neg rdi
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.24:
+.L.bb.cmul.23:
+    cmp rsi, 8
+    jne .L.bb.cmul.26
+.L.bb.cmul.25:
+    mov rdi, rcx
+    shl rdi, 1
+    neg rdi
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.27:
+.L.bb.cmul.26:
+    cmp rsi, 9
+    jne .L.bb.cmul.29
+.L.bb.cmul.28:
+    lea rdi, [rcx + rcx*2]
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.30:
+.L.bb.cmul.29:
+    cmp rsi, 10
+    jne .L.bb.cmul.32
+.L.bb.cmul.31:
+    lea rdi, [rcx + rcx*2]
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.33:
+.L.bb.cmul.32:
+    cmp rsi, 11
+    jne .L.bb.cmul.35
+.L.bb.cmul.34:
+    lea rdi, [rcx + rcx*2]
+    neg rdi
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.36:
+.L.bb.cmul.35:
+    cmp rsi, 12
+    jne .L.bb.cmul.38
+.L.bb.cmul.37:
+    lea rdi, [rcx + rcx*2]
+    neg rdi
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.39:
+.L.bb.cmul.38:
+    cmp rsi, 13
+    jne .L.bb.cmul.41
+.L.bb.cmul.40:
+    mov rdi, rcx
+    shl rdi, 2
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.42:
+.L.bb.cmul.41:
+    cmp rsi, 14
+    jne .L.bb.cmul.44
+.L.bb.cmul.43:
+    mov rdi, rcx
+    shl rdi, 2
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.45:
+.L.bb.cmul.44:
+    cmp rsi, 15
+    jne .L.bb.cmul.47
+.L.bb.cmul.46:
+    mov rdi, rcx
+    shl rdi, 2
+    neg rdi
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.48:
+.L.bb.cmul.47:
+    cmp rsi, 16
+    jne .L.bb.cmul.50
+.L.bb.cmul.49:
+    mov rdi, rcx
+    shl rdi, 2
+    neg rdi
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.51:
+.L.bb.cmul.50:
+    cmp rsi, 17
+    jne .L.bb.cmul.53
+.L.bb.cmul.52:
+    lea rdi, [rcx + rcx*4]
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.54:
+.L.bb.cmul.53:
+    cmp rsi, 18
+    jne .L.bb.cmul.56
+.L.bb.cmul.55:
+    lea rdi, [rcx + rcx*4]
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.57:
+.L.bb.cmul.56:
+    cmp rsi, 19
+    jne .L.bb.cmul.59
+.L.bb.cmul.58:
+    lea rdi, [rcx + rcx*4]
+    neg rdi
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.60:
+.L.bb.cmul.59:
+    cmp rsi, 20
+    jne .L.bb.cmul.62
+.L.bb.cmul.61:
+    lea rdi, [rcx + rcx*4]
+    neg rdi
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.63:
+.L.bb.cmul.62:
+    cmp rsi, 21
+    jne .L.bb.cmul.65
+.L.bb.cmul.64:
+    lea rdi, [rcx + rcx*2]
+    shl rdi, 1
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.66:
+.L.bb.cmul.65:
+    cmp rsi, 22
+    jne .L.bb.cmul.68
+.L.bb.cmul.67:
+    lea rdi, [rcx + rcx*2]
+    shl rdi, 1
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.69:
+.L.bb.cmul.68:
+    cmp rsi, 23
+    jne .L.bb.cmul.71
+.L.bb.cmul.70:
+    lea rdi, [rcx + rcx*2]
+    shl rdi, 1
+    neg rdi
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.72:
+.L.bb.cmul.71:
+    cmp rsi, 24
+    jne .L.bb.cmul.74
+.L.bb.cmul.73:
+    lea rdi, [rcx + rcx*2]
+    shl rdi, 1
+    neg rdi
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.75:
+.L.bb.cmul.74:
+    cmp rsi, 25
+    jne .L.bb.cmul.77
+.L.bb.cmul.76:
+    mov rdi, rcx
+    imul rdi, 7
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.78:
+.L.bb.cmul.77:
+    cmp rsi, 26
+    jne .L.bb.cmul.80
+.L.bb.cmul.79:
+    mov rdi, rcx
+    imul rdi, 7
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.81:
+.L.bb.cmul.80:
+    cmp rsi, 27
+    jne .L.bb.cmul.83
+.L.bb.cmul.82:
+    mov rdi, rcx
+    imul rdi, -7
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.84:
+.L.bb.cmul.83:
+    cmp rsi, 28
+    jne .L.bb.cmul.86
+.L.bb.cmul.85:
+    mov rdi, rcx
+    imul rdi, -7
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.87:
+.L.bb.cmul.86:
+    cmp rsi, 29
+    jne .L.bb.cmul.89
+.L.bb.cmul.88:
+    mov rdi, rcx
+    shl rdi, 3
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.90:
+.L.bb.cmul.89:
+    cmp rsi, 30
+    jne .L.bb.cmul.92
+.L.bb.cmul.91:
+    mov rdi, rcx
+    shl rdi, 3
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.93:
+.L.bb.cmul.92:
+    cmp rsi, 31
+    jne .L.bb.cmul.95
+.L.bb.cmul.94:
+    mov rdi, rcx
+    shl rdi, 3
+    neg rdi
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.96:
+.L.bb.cmul.95:
+    cmp rsi, 32
+    jne .L.bb.cmul.98
+.L.bb.cmul.97:
+    mov rdi, rcx
+    shl rdi, 3
+    neg rdi
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.99:
+.L.bb.cmul.98:
+    cmp rsi, 33
+    jne .L.bb.cmul.101
+.L.bb.cmul.100:
+    lea rdi, [rcx + rcx*8]
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.102:
+.L.bb.cmul.101:
+    cmp rsi, 34
+    jne .L.bb.cmul.104
+.L.bb.cmul.103:
+    lea rdi, [rcx + rcx*8]
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.105:
+.L.bb.cmul.104:
+    cmp rsi, 35
+    jne .L.bb.cmul.107
+.L.bb.cmul.106:
+    lea rdi, [rcx + rcx*8]
+    neg rdi
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.108:
+.L.bb.cmul.107:
+    cmp rsi, 36
+    jne .L.bb.cmul.110
+.L.bb.cmul.109:
+    lea rdi, [rcx + rcx*8]
+    neg rdi
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.111:
+.L.bb.cmul.110:
+    cmp rsi, 37
+    jne .L.bb.cmul.113
+.L.bb.cmul.112:
+    lea rdi, [rcx + rcx*4]
+    shl rdi, 1
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.114:
+.L.bb.cmul.113:
+    cmp rsi, 38
+    jne .L.bb.cmul.116
+.L.bb.cmul.115:
+    lea rdi, [rcx + rcx*4]
+    shl rdi, 1
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.117:
+.L.bb.cmul.116:
+    cmp rsi, 39
+    jne .L.bb.cmul.119
+.L.bb.cmul.118:
+    lea rdi, [rcx + rcx*4]
+    shl rdi, 1
+    neg rdi
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.120:
+.L.bb.cmul.119:
+    cmp rsi, 40
+    jne .L.bb.cmul.122
+.L.bb.cmul.121:
+    lea rdi, [rcx + rcx*4]
+    shl rdi, 1
+    neg rdi
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.123:
+.L.bb.cmul.122:
+    cmp rsi, 41
+    jne .L.bb.cmul.125
+.L.bb.cmul.124:
+    mov rdi, rcx
+    imul rdi, 11
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.126:
+.L.bb.cmul.125:
+    cmp rsi, 42
+    jne .L.bb.cmul.128
+.L.bb.cmul.127:
+    mov rdi, rcx
+    imul rdi, 11
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.129:
+.L.bb.cmul.128:
+    cmp rsi, 43
+    jne .L.bb.cmul.131
+.L.bb.cmul.130:
+    mov rdi, rcx
+    imul rdi, -11
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.132:
+.L.bb.cmul.131:
+    cmp rsi, 44
+    jne .L.bb.cmul.134
+.L.bb.cmul.133:
+    mov rdi, rcx
+    imul rdi, -11
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.135:
+.L.bb.cmul.134:
+    cmp rsi, 45
+    jne .L.bb.cmul.137
+.L.bb.cmul.136:
+    lea rdi, [rcx + rcx*2]
+    shl rdi, 2
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.138:
+.L.bb.cmul.137:
+    cmp rsi, 46
+    jne .L.bb.cmul.140
+.L.bb.cmul.139:
+    lea rdi, [rcx + rcx*2]
+    shl rdi, 2
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.141:
+.L.bb.cmul.140:
+    cmp rsi, 47
+    jne .L.bb.cmul.143
+.L.bb.cmul.142:
+    lea rdi, [rcx + rcx*2]
+    shl rdi, 2
+    neg rdi
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.144:
+.L.bb.cmul.143:
+    cmp rsi, 48
+    jne .L.bb.cmul.146
+.L.bb.cmul.145:
+    lea rdi, [rcx + rcx*2]
+    shl rdi, 2
+    neg rdi
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.147:
+.L.bb.cmul.146:
+    cmp rsi, 49
+    jne .L.bb.cmul.149
+.L.bb.cmul.148:
+    mov rdi, rcx
+    imul rdi, 13
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.150:
+.L.bb.cmul.149:
+    cmp rsi, 50
+    jne .L.bb.cmul.152
+.L.bb.cmul.151:
+    mov rdi, rcx
+    imul rdi, 13
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.153:
+.L.bb.cmul.152:
+    cmp rsi, 51
+    jne .L.bb.cmul.155
+.L.bb.cmul.154:
+    mov rdi, rcx
+    imul rdi, -13
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.156:
+.L.bb.cmul.155:
+    cmp rsi, 52
+    jne .L.bb.cmul.158
+.L.bb.cmul.157:
+    mov rdi, rcx
+    imul rdi, -13
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.159:
+.L.bb.cmul.158:
+    cmp rsi, 53
+    jne .L.bb.cmul.161
+.L.bb.cmul.160:
+    mov rdi, rcx
+    imul rdi, 15
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.162:
+.L.bb.cmul.161:
+    cmp rsi, 54
+    jne .L.bb.cmul.164
+.L.bb.cmul.163:
+    mov rdi, rcx
+    imul rdi, 15
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.165:
+.L.bb.cmul.164:
+    cmp rsi, 55
+    jne .L.bb.cmul.167
+.L.bb.cmul.166:
+    mov rdi, rcx
+    imul rdi, -15
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.168:
+.L.bb.cmul.167:
+    cmp rsi, 56
+    jne .L.bb.cmul.170
+.L.bb.cmul.169:
+    mov rdi, rcx
+    imul rdi, -15
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.171:
+.L.bb.cmul.170:
+    cmp rsi, 57
+    jne .L.bb.cmul.173
+.L.bb.cmul.172:
+    mov rdi, rcx
+    shl rdi, 4
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.174:
+.L.bb.cmul.173:
+    cmp rsi, 58
+    jne .L.bb.cmul.176
+.L.bb.cmul.175:
+    mov rdi, rcx
+    shl rdi, 4
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.177:
+.L.bb.cmul.176:
+    cmp rsi, 59
+    jne .L.bb.cmul.179
+.L.bb.cmul.178:
+    mov rdi, rcx
+    shl rdi, 4
+    neg rdi
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.180:
+.L.bb.cmul.179:
+    cmp rsi, 60
+    jne .L.bb.cmul.182
+.L.bb.cmul.181:
+    mov rdi, rcx
+    shl rdi, 4
+    neg rdi
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.183:
+.L.bb.cmul.182:
+    cmp rsi, 61
+    jne .L.bb.cmul.185
+.L.bb.cmul.184:
+    mov rdi, rcx
+    imul rdi, 17
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.186:
+.L.bb.cmul.185:
+    cmp rsi, 62
+    jne .L.bb.cmul.188
+.L.bb.cmul.187:
+    mov rdi, rcx
+    imul rdi, 17
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.189:
+.L.bb.cmul.188:
+    cmp rsi, 63
+    jne .L.bb.cmul.191
+.L.bb.cmul.190:
+    mov rdi, rcx
+    imul rdi, -17
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.192:
+.L.bb.cmul.191:
+    cmp rsi, 64
+    jne .L.bb.cmul.194
+.L.bb.cmul.193:
+    mov rdi, rcx
+    imul rdi, -17
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.195:
+.L.bb.cmul.194:
+    cmp rsi, 65
+    jne .L.bb.cmul.197
+.L.bb.cmul.196:
+    lea rdi, [rcx + rcx*2]
+    shl rdi, 3
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.198:
+.L.bb.cmul.197:
+    cmp rsi, 66
+    jne .L.bb.cmul.200
+.L.bb.cmul.199:
+    lea rdi, [rcx + rcx*2]
+    shl rdi, 3
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.201:
+.L.bb.cmul.200:
+    cmp rsi, 67
+    jne .L.bb.cmul.203
+.L.bb.cmul.202:
+    lea rdi, [rcx + rcx*2]
+    shl rdi, 3
+    neg rdi
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.204:
+.L.bb.cmul.203:
+    cmp rsi, 68
+    jne .L.bb.cmul.206
+.L.bb.cmul.205:
+    lea rdi, [rcx + rcx*2]
+    shl rdi, 3
+    neg rdi
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.207:
+.L.bb.cmul.206:
+    cmp rsi, 69
+    jne .L.bb.cmul.209
+.L.bb.cmul.208:
+    mov rdi, rcx
+    imul rdi, 25
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.210:
+.L.bb.cmul.209:
+    cmp rsi, 70
+    jne .L.bb.cmul.212
+.L.bb.cmul.211:
+    mov rdi, rcx
+    imul rdi, 25
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.213:
+.L.bb.cmul.212:
+    cmp rsi, 71
+    jne .L.bb.cmul.215
+.L.bb.cmul.214:
+    mov rdi, rcx
+    imul rdi, -25
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.216:
+.L.bb.cmul.215:
+    cmp rsi, 72
+    jne .L.bb.cmul.218
+.L.bb.cmul.217:
+    mov rdi, rcx
+    imul rdi, -25
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.219:
+.L.bb.cmul.218:
+    cmp rsi, 73
+    jne .L.bb.cmul.221
+.L.bb.cmul.220:
+    mov rdi, rcx
+    imul rdi, 31
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.222:
+.L.bb.cmul.221:
+    cmp rsi, 74
+    jne .L.bb.cmul.224
+.L.bb.cmul.223:
+    mov rdi, rcx
+    imul rdi, 31
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.225:
+.L.bb.cmul.224:
+    cmp rsi, 75
+    jne .L.bb.cmul.227
+.L.bb.cmul.226:
+    mov rdi, rcx
+    imul rdi, -31
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.228:
+.L.bb.cmul.227:
+    cmp rsi, 76
+    jne .L.bb.cmul.230
+.L.bb.cmul.229:
+    mov rdi, rcx
+    imul rdi, -31
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.231:
+.L.bb.cmul.230:
+    cmp rsi, 77
+    jne .L.bb.cmul.233
+.L.bb.cmul.232:
+    mov rdi, rcx
+    shl rdi, 5
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.234:
+.L.bb.cmul.233:
+    cmp rsi, 78
+    jne .L.bb.cmul.236
+.L.bb.cmul.235:
+    mov rdi, rcx
+    shl rdi, 5
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.237:
+.L.bb.cmul.236:
+    cmp rsi, 79
+    jne .L.bb.cmul.239
+.L.bb.cmul.238:
+    mov rdi, rcx
+    shl rdi, 5
+    neg rdi
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.240:
+.L.bb.cmul.239:
+    cmp rsi, 80
+    jne .L.bb.cmul.242
+.L.bb.cmul.241:
+    mov rdi, rcx
+    shl rdi, 5
+    neg rdi
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.243:
+.L.bb.cmul.242:
+    cmp rsi, 81
+    jne .L.bb.cmul.245
+.L.bb.cmul.244:
+    lea rdi, [rcx + rcx*8]
+    shl rdi, 2
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.246:
+.L.bb.cmul.245:
+    cmp rsi, 82
+    jne .L.bb.cmul.248
+.L.bb.cmul.247:
+    lea rdi, [rcx + rcx*8]
+    shl rdi, 2
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.249:
+.L.bb.cmul.248:
+    cmp rsi, 83
+    jne .L.bb.cmul.251
+.L.bb.cmul.250:
+    lea rdi, [rcx + rcx*8]
+    shl rdi, 2
+    neg rdi
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.252:
+.L.bb.cmul.251:
+    cmp rsi, 84
+    jne .L.bb.cmul.254
+.L.bb.cmul.253:
+    lea rdi, [rcx + rcx*8]
+    shl rdi, 2
+    neg rdi
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.255:
+.L.bb.cmul.254:
+    cmp rsi, 85
+    jne .L.bb.cmul.257
+.L.bb.cmul.256:
+    lea rdi, [rcx + rcx*4]
+    shl rdi, 3
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.258:
+.L.bb.cmul.257:
+    cmp rsi, 86
+    jne .L.bb.cmul.260
+.L.bb.cmul.259:
+    lea rdi, [rcx + rcx*4]
+    shl rdi, 3
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.261:
+.L.bb.cmul.260:
+    cmp rsi, 87
+    jne .L.bb.cmul.263
+.L.bb.cmul.262:
+    lea rdi, [rcx + rcx*4]
+    shl rdi, 3
+    neg rdi
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.264:
+.L.bb.cmul.263:
+    cmp rsi, 88
+    jne .L.bb.cmul.266
+.L.bb.cmul.265:
+    lea rdi, [rcx + rcx*4]
+    shl rdi, 3
+    neg rdi
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.267:
+.L.bb.cmul.266:
+    cmp rsi, 89
+    jne .L.bb.cmul.269
+.L.bb.cmul.268:
+    mov rdi, rcx
+    imul rdi, 45
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.270:
+.L.bb.cmul.269:
+    cmp rsi, 90
+    jne .L.bb.cmul.272
+.L.bb.cmul.271:
+    mov rdi, rcx
+    imul rdi, 45
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.273:
+.L.bb.cmul.272:
+    cmp rsi, 91
+    jne .L.bb.cmul.275
+.L.bb.cmul.274:
+    mov rdi, rcx
+    imul rdi, -45
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.276:
+.L.bb.cmul.275:
+    cmp rsi, 92
+    jne .L.bb.cmul.278
+.L.bb.cmul.277:
+    mov rdi, rcx
+    imul rdi, -45
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.279:
+.L.bb.cmul.278:
+    cmp rsi, 93
+    jne .L.bb.cmul.281
+.L.bb.cmul.280:
+    mov rdi, rcx
+    imul rdi, 63
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.282:
+.L.bb.cmul.281:
+    cmp rsi, 94
+    jne .L.bb.cmul.284
+.L.bb.cmul.283:
+    mov rdi, rcx
+    imul rdi, 63
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.285:
+.L.bb.cmul.284:
+    cmp rsi, 95
+    jne .L.bb.cmul.287
+.L.bb.cmul.286:
+    mov rdi, rcx
+    imul rdi, -63
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.288:
+.L.bb.cmul.287:
+    cmp rsi, 96
+    jne .L.bb.cmul.290
+.L.bb.cmul.289:
+    mov rdi, rcx
+    imul rdi, -63
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.291:
+.L.bb.cmul.290:
+    cmp rsi, 97
+    jne .L.bb.cmul.293
+.L.bb.cmul.292:
+    mov rdi, rcx
+    shl rdi, 6
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.294:
+.L.bb.cmul.293:
+    cmp rsi, 98
+    jne .L.bb.cmul.296
+.L.bb.cmul.295:
+    mov rdi, rcx
+    shl rdi, 6
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.297:
+.L.bb.cmul.296:
+    cmp rsi, 99
+    jne .L.bb.cmul.299
+.L.bb.cmul.298:
+    mov rdi, rcx
+    shl rdi, 6
+    neg rdi
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.300:
+.L.bb.cmul.299:
+    cmp rsi, 100
+    jne .L.bb.cmul.302
+.L.bb.cmul.301:
+    mov rdi, rcx
+    shl rdi, 6
+    neg rdi
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.303:
+.L.bb.cmul.302:
+    cmp rsi, 101
+    jne .L.bb.cmul.305
+.L.bb.cmul.304:
+    lea rdi, [rcx + rcx*8]
+    shl rdi, 3
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.306:
+.L.bb.cmul.305:
+    cmp rsi, 102
+    jne .L.bb.cmul.308
+.L.bb.cmul.307:
+    lea rdi, [rcx + rcx*8]
+    shl rdi, 3
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.309:
+.L.bb.cmul.308:
+    cmp rsi, 103
+    jne .L.bb.cmul.311
+.L.bb.cmul.310:
+    lea rdi, [rcx + rcx*8]
+    shl rdi, 3
+    neg rdi
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.312:
+.L.bb.cmul.311:
+    cmp rsi, 104
+    jne .L.bb.cmul.314
+.L.bb.cmul.313:
+    lea rdi, [rcx + rcx*8]
+    shl rdi, 3
+    neg rdi
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.315:
+.L.bb.cmul.314:
+    cmp rsi, 105
+    jne .L.bb.cmul.317
+.L.bb.cmul.316:
+    mov rdi, rcx
+    imul rdi, 100
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.318:
+.L.bb.cmul.317:
+    cmp rsi, 106
+    jne .L.bb.cmul.320
+.L.bb.cmul.319:
+    mov rdi, rcx
+    imul rdi, 100
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.321:
+.L.bb.cmul.320:
+    cmp rsi, 107
+    jne .L.bb.cmul.323
+.L.bb.cmul.322:
+    mov rdi, rcx
+    imul rdi, -100
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.324:
+.L.bb.cmul.323:
+    cmp rsi, 108
+    jne .L.bb.cmul.326
+.L.bb.cmul.325:
+    mov rdi, rcx
+    imul rdi, -100
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.327:
+.L.bb.cmul.326:
+    cmp rsi, 109
+    jne .L.bb.cmul.329
+.L.bb.cmul.328:
+    mov rdi, rcx
+    imul rdi, 127
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.330:
+.L.bb.cmul.329:
+    cmp rsi, 110
+    jne .L.bb.cmul.332
+.L.bb.cmul.331:
+    mov rdi, rcx
+    imul rdi, 127
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.333:
+.L.bb.cmul.332:
+    cmp rsi, 111
+    jne .L.bb.cmul.335
+.L.bb.cmul.334:
+    mov rdi, rcx
+    imul rdi, -127
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.336:
+.L.bb.cmul.335:
+    cmp rsi, 112
+    jne .L.bb.cmul.338
+.L.bb.cmul.337:
+    mov rdi, rcx
+    imul rdi, -127
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.339:
+.L.bb.cmul.338:
+    cmp rsi, 113
+    jne .L.bb.cmul.341
+.L.bb.cmul.340:
+    mov rdi, rcx
+    shl rdi, 7
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.342:
+.L.bb.cmul.341:
+    cmp rsi, 114
+    jne .L.bb.cmul.344
+.L.bb.cmul.343:
+    mov rdi, rcx
+    shl rdi, 7
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.345:
+.L.bb.cmul.344:
+    cmp rsi, 115
+    jne .L.bb.cmul.347
+.L.bb.cmul.346:
+    mov rdi, rcx
+    shl rdi, 7
+    neg rdi
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.348:
+.L.bb.cmul.347:
+    cmp rsi, 116
+    jne .L.bb.cmul.350
+.L.bb.cmul.349:
+    mov rdi, rcx
+    shl rdi, 7
+    neg rdi
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.351:
+.L.bb.cmul.350:
+    cmp rsi, 117
+    jne .L.bb.cmul.353
+.L.bb.cmul.352:
+    mov rdi, rcx
+    imul rdi, 255
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.354:
+.L.bb.cmul.353:
+    cmp rsi, 118
+    jne .L.bb.cmul.356
+.L.bb.cmul.355:
+    mov rdi, rcx
+    imul rdi, 255
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.357:
+.L.bb.cmul.356:
+    cmp rsi, 119
+    jne .L.bb.cmul.359
+.L.bb.cmul.358:
+    mov rdi, rcx
+    imul rdi, -255
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.360:
+.L.bb.cmul.359:
+    cmp rsi, 120
+    jne .L.bb.cmul.362
+.L.bb.cmul.361:
+    mov rdi, rcx
+    imul rdi, -255
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.363:
+.L.bb.cmul.362:
+    cmp rsi, 121
+    jne .L.bb.cmul.365
+.L.bb.cmul.364:
+    mov rdi, rcx
+    imul rdi, 641
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.366:
+.L.bb.cmul.365:
+    cmp rsi, 122
+    jne .L.bb.cmul.368
+.L.bb.cmul.367:
+    mov rdi, rcx
+    imul rdi, 641
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.369:
+.L.bb.cmul.368:
+    cmp rsi, 123
+    jne .L.bb.cmul.371
+.L.bb.cmul.370:
+    mov rdi, rcx
+    imul rdi, -641
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.372:
+.L.bb.cmul.371:
+    cmp rsi, 124
+    jne .L.bb.cmul.374
+.L.bb.cmul.373:
+    mov rdi, rcx
+    imul rdi, -641
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.375:
+.L.bb.cmul.374:
+    cmp rsi, 125
+    jne .L.bb.cmul.377
+.L.bb.cmul.376:
+    mov rdi, rcx
+    imul rdi, 1000
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.378:
+.L.bb.cmul.377:
+    cmp rsi, 126
+    jne .L.bb.cmul.380
+.L.bb.cmul.379:
+    mov rdi, rcx
+    imul rdi, 1000
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.381:
+.L.bb.cmul.380:
+    cmp rsi, 127
+    jne .L.bb.cmul.383
+.L.bb.cmul.382:
+    mov rdi, rcx
+    imul rdi, -1000
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.384:
+.L.bb.cmul.383:
+    cmp rsi, 128
+    jne .L.bb.cmul.386
+.L.bb.cmul.385:
+    mov rdi, rcx
+    imul rdi, -1000
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.387:
+.L.bb.cmul.386:
+    cmp rsi, 129
+    jne .L.bb.cmul.389
+.L.bb.cmul.388:
+    mov rdi, rcx
+    shl rdi, 12
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.390:
+.L.bb.cmul.389:
+    cmp rsi, 130
+    jne .L.bb.cmul.392
+.L.bb.cmul.391:
+    mov rdi, rcx
+    shl rdi, 12
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.393:
+.L.bb.cmul.392:
+    cmp rsi, 131
+    jne .L.bb.cmul.395
+.L.bb.cmul.394:
+    mov rdi, rcx
+    shl rdi, 12
+    neg rdi
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.396:
+.L.bb.cmul.395:
+    cmp rsi, 132
+    jne .L.bb.cmul.398
+.L.bb.cmul.397:
+    mov rdi, rcx
+    shl rdi, 12
+    neg rdi
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.399:
+.L.bb.cmul.398:
+    cmp rsi, 133
+    jne .L.bb.cmul.401
+.L.bb.cmul.400:
+    mov rdi, rcx
+    imul rdi, 65537
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.402:
+.L.bb.cmul.401:
+    cmp rsi, 134
+    jne .L.bb.cmul.404
+.L.bb.cmul.403:
+    mov rdi, rcx
+    imul rdi, 65537
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.405:
+.L.bb.cmul.404:
+    cmp rsi, 135
+    jne .L.bb.cmul.407
+.L.bb.cmul.406:
+    mov rdi, rcx
+    imul rdi, -65537
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.408:
+.L.bb.cmul.407:
+    cmp rsi, 136
+    jne .L.bb.cmul.410
+.L.bb.cmul.409:
+    mov rdi, rcx
+    imul rdi, -65537
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.411:
+.L.bb.cmul.410:
+    cmp rsi, 137
+    jne .L.bb.cmul.413
+.L.bb.cmul.412:
+    mov rdi, rcx
+    imul rdi, 6700417
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.414:
+.L.bb.cmul.413:
+    cmp rsi, 138
+    jne .L.bb.cmul.416
+.L.bb.cmul.415:
+    mov rdi, rcx
+    imul rdi, 6700417
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.417:
+.L.bb.cmul.416:
+    cmp rsi, 139
+    jne .L.bb.cmul.419
+.L.bb.cmul.418:
+    mov rdi, rcx
+    imul rdi, -6700417
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.420:
+.L.bb.cmul.419:
+    cmp rsi, 140
+    jne .L.bb.cmul.422
+.L.bb.cmul.421:
+    mov rdi, rcx
+    imul rdi, -6700417
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.423:
+.L.bb.cmul.422:
+    cmp rsi, 141
+    jne .L.bb.cmul.425
+.L.bb.cmul.424:
+    mov rdi, rcx
+    imul rdi, 1000000007
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.426:
+.L.bb.cmul.425:
+    cmp rsi, 142
+    jne .L.bb.cmul.428
+.L.bb.cmul.427:
+    mov rdi, rcx
+    imul rdi, 1000000007
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.429:
+.L.bb.cmul.428:
+    cmp rsi, 143
+    jne .L.bb.cmul.431
+.L.bb.cmul.430:
+    mov rdi, rcx
+    imul rdi, -1000000007
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.432:
+.L.bb.cmul.431:
+    cmp rsi, 144
+    jne .L.bb.cmul.434
+.L.bb.cmul.433:
+    mov rdi, rcx
+    imul rdi, -1000000007
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.435:
+.L.bb.cmul.434:
+    cmp rsi, 145
+    jne .L.bb.cmul.437
+.L.bb.cmul.436:
+    mov rdi, rcx
+    imul rdi, 2147483647
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.438:
+.L.bb.cmul.437:
+    cmp rsi, 146
+    jne .L.bb.cmul.440
+.L.bb.cmul.439:
+    mov rdi, rcx
+    imul rdi, 2147483647
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.441:
+.L.bb.cmul.440:
+    cmp rsi, 147
+    jne .L.bb.cmul.443
+.L.bb.cmul.442:
+    mov rdi, rcx
+    imul rdi, -2147483647
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.444:
+.L.bb.cmul.443:
+    cmp rsi, 148
+    jne .L.bb.cmul.446
+.L.bb.cmul.445:
+    mov rdi, rcx
+    imul rdi, -2147483647
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.447:
+.L.bb.cmul.446:
+    cmp rsi, 149
+    jne .L.bb.cmul.449
+.L.bb.cmul.448:
+    mov rdi, rcx
+    shl rdi, 31
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.450:
+.L.bb.cmul.449:
+    cmp rsi, 150
+    jne .L.bb.cmul.452
+.L.bb.cmul.451:
+    mov rdi, rcx
+    shl rdi, 31
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.453:
+.L.bb.cmul.452:
+    cmp rsi, 151
+    jne .L.bb.cmul.455
+.L.bb.cmul.454:
+    mov rdi, rcx
+    shl rdi, 31
+    neg rdi
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.456:
+.L.bb.cmul.455:
+    cmp rsi, 152
+    jne .L.bb.cmul.458
+.L.bb.cmul.457:
+    mov rdi, rcx
+    shl rdi, 31
+    neg rdi
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.459:
+.L.bb.cmul.458:
+    cmp rsi, 153
+    jne .L.bb.cmul.461
+.L.bb.cmul.460:
+    mov rdi, rcx
+    shl rdi, 32
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.462:
+.L.bb.cmul.461:
+    cmp rsi, 154
+    jne .L.bb.cmul.464
+.L.bb.cmul.463:
+    mov rdi, rcx
+    shl rdi, 32
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.465:
+.L.bb.cmul.464:
+    cmp rsi, 155
+    jne .L.bb.cmul.467
+.L.bb.cmul.466:
+    mov rdi, rcx
+    shl rdi, 32
+    neg rdi
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.468:
+.L.bb.cmul.467:
+    cmp rsi, 156
+    jne .L.bb.cmul.470
+.L.bb.cmul.469:
+    mov rdi, rcx
+    shl rdi, 32
+    neg rdi
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.471:
+.L.bb.cmul.470:
+    cmp rsi, 157
+    jne .L.bb.cmul.473
+.L.bb.cmul.472:
+    mov rdi, rcx
+    shl rdi, 40
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.474:
+.L.bb.cmul.473:
+    cmp rsi, 158
+    jne .L.bb.cmul.476
+.L.bb.cmul.475:
+    mov rdi, rcx
+    shl rdi, 40
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.477:
+.L.bb.cmul.476:
+    cmp rsi, 159
+    jne .L.bb.cmul.479
+.L.bb.cmul.478:
+    mov rdi, rcx
+    shl rdi, 40
+    neg rdi
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.480:
+.L.bb.cmul.479:
+    cmp rsi, 160
+    jne .L.bb.cmul.482
+.L.bb.cmul.481:
+    mov rdi, rcx
+    shl rdi, 40
+    neg rdi
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.483:
+.L.bb.cmul.482:
+    cmp rsi, 161
+    jne .L.bb.cmul.485
+.L.bb.cmul.484:
+    mov rdi, rcx
+    shl rdi, 62
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.486:
+.L.bb.cmul.485:
+    cmp rsi, 162
+    jne .L.bb.cmul.488
+.L.bb.cmul.487:
+    mov rdi, rcx
+    shl rdi, 62
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.489:
+.L.bb.cmul.488:
+    cmp rsi, 163
+    jne .L.bb.cmul.491
+.L.bb.cmul.490:
+    mov rdi, rcx
+    shl rdi, 62
+    neg rdi
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.492:
+.L.bb.cmul.491:
+    cmp rsi, 164
+    jne .L.bb.cmul.494
+.L.bb.cmul.493:
+    mov rdi, rcx
+    shl rdi, 62
+    neg rdi
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.495:
+.L.bb.cmul.494:
+    cmp rsi, 165
+    jne .L.bb.cmul.497
+.L.bb.cmul.496:
+    mov rdi, 9223372036854775807
+    mov r8, rcx
+    imul r8, rdi
+    mov rax, r8
+    jmp .L.return.cmul
+.L.bb.cmul.498:
+.L.bb.cmul.497:
+    cmp rsi, 166
+    jne .L.bb.cmul.500
+.L.bb.cmul.499:
+    mov rdi, 9223372036854775807
+    imul rdi, rcx
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.501:
+.L.bb.cmul.500:
+    cmp rsi, 167
+    jne .L.bb.cmul.503
+.L.bb.cmul.502:
+    mov rdi, -9223372036854775807
+    mov r8, rcx
+    imul r8, rdi
+    mov rax, r8
+    jmp .L.return.cmul
+.L.bb.cmul.504:
+.L.bb.cmul.503:
+    cmp rsi, 168
+    jne .L.bb.cmul.506
+.L.bb.cmul.505:
+    mov rdi, -9223372036854775807
+    imul rdi, rcx
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.507:
+.L.bb.cmul.506:
+    cmp rsi, 169
+    jne .L.bb.cmul.509
+.L.bb.cmul.508:
+    mov rdi, rcx
+    shl rdi, 63
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.510:
+.L.bb.cmul.509:
+    cmp rsi, 170
+    jne .L.bb.cmul.512
+.L.bb.cmul.511:
+    mov rdi, rcx
+    shl rdi, 63
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.513:
+.L.bb.cmul.512:
+    cmp rsi, 171
+    jne .L.bb.cmul.515
+.L.bb.cmul.514:
+    mov rdi, rcx
+    shl rdi, 63
+    mov rax, rdi
+    jmp .L.return.cmul
+.L.bb.cmul.516:
+.L.bb.cmul.515:
+    cmp rsi, 172
+    jne .L.bb.cmul.518
+.L.bb.cmul.517:
+    shl rcx, 63
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.519:
+.L.bb.cmul.518:
+    mov rax, 0
+.L.return.cmul:
+    mov rsp, rbp
+    pop rbp
+    ret
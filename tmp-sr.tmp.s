@@ -0,0 +1,4668 @@
+.intel_syntax noprefix
+    .globl cdiv
+    .text
+cdiv:
+    push rbp
+    mov rbp, rsp
+    sub rsp, 16
+    mov [rbp - 8], rdi
+    mov [rbp - 16], rsi
+.L.bb.cdiv.0:
+    mov rcx, 0
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cdiv.2
+.L.bb.cdiv.1:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    mov rax, rcx
+    jmp .L.return.cdiv
+.L.bb.cdiv.3:
+.L.bb.cdiv.2:
+    mov rcx, 1
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cdiv.5
+.L.bb.cdiv.4:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    neg rcx
+    mov rax, rcx
+    jmp .L.return.cdiv
+.L.bb.cdiv.6:
+.L.bb.cdiv.5:
+    mov rcx, 2
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cdiv.8
+.L.bb.cdiv.7:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    mov rsi, rcx
+    sar rsi, 63
+    shr rsi, 63
+    add rsi, rcx
+    sar rsi, 1
+    mov rax, rsi
+    jmp .L.return.cdiv
+.L.bb.cdiv.9:
+.L.bb.cdiv.8:
+    mov rcx, 3
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cdiv.11
+.L.bb.cdiv.10:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    mov rsi, rcx
+    sar rsi, 63
+    shr rsi, 63
+    add rsi, rcx
+    sar rsi, 1
+    neg rsi
+    mov rax, rsi
+    jmp .L.return.cdiv
+.L.bb.cdiv.12:
+.L.bb.cdiv.11:
+    mov rcx, 4
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cdiv.14
+.L.bb.cdiv.13:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    mov rax, 6148914691236517206
+    imul rcx
+    mov rcx, rdx
+    shr rcx, 63
+    add rcx, rdx
+    mov rax, rcx
+    jmp .L.return.cdiv
+.L.bb.cdiv.15:
+.L.bb.cdiv.14:
+    mov rcx, 5
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cdiv.17
+.L.bb.cdiv.16:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    mov rax, 6148914691236517205
+    imul rcx
+    sub rdx, rcx
+    sar rdx, 1
+    mov rcx, rdx
+    shr rcx, 63
+    add rcx, rdx
+    mov rax, rcx
+    jmp .L.return.cdiv
+.L.bb.cdiv.18:
+.L.bb.cdiv.17:
+    mov rcx, 6
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cdiv.20
+.L.bb.cdiv.19:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    mov rsi, rcx
+    sar rsi, 63
+    shr rsi, 62
+    add rsi, rcx
+    sar rsi, 2
+    mov rax, rsi
+    jmp .L.return.cdiv
+.L.bb.cdiv.21:
+.L.bb.cdiv.20:
+    mov rcx, 7
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cdiv.23
+.L.bb.cdiv.22:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    mov rsi, rcx
+    sar rsi, 63
+    shr rsi, 62
+    add rsi, rcx
+    sar rsi, 2
+    neg rsi
+    mov rax, rsi
+    jmp .L.return.cdiv
+.L.bb.cdiv.24:
+.L.bb.cdiv.23:
+    mov rcx, 8
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cdiv.26
+.L.bb.cdiv.25:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    mov rax, 7378697629483820647
+    imul rcx
+    sar rdx, 1
+    mov rcx, rdx
+    shr rcx, 63
+    add rcx, rdx
+    mov rax, rcx
+    jmp .L.return.cdiv
+.L.bb.cdiv.27:
+.L.bb.cdiv.26:
+    mov rcx, 9
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cdiv.29
+.L.bb.cdiv.28:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    mov rax, -7378697629483820647
+    imul rcx
+    sar rdx, 1
+    mov rcx, rdx
+    shr rcx, 63
+    add rcx, rdx
+    mov rax, rcx
+    jmp .L.return.cdiv
+.L.bb.cdiv.30:
+.L.bb.cdiv.29:
+    mov rcx, 10
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cdiv.32
+.L.bb.cdiv.31:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    mov rax, 3074457345618258603
+    imul rcx
+    mov rcx, rdx
+    shr rcx, 63
+    add rcx, rdx
+    mov rax, rcx
+    jmp .L.return.cdiv
+.L.bb.cdiv.33:
+.L.bb.cdiv.32:
+    mov rcx, 11
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cdiv.35
+.L.bb.cdiv.34:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    mov rax, -3074457345618258603
+    imul rcx
+    mov rcx, rdx
+    shr rcx, 63
+    add rcx, rdx
+    mov rax, rcx
+    jmp .L.return.cdiv
+.L.bb.cdiv.36:
+.L.bb.cdiv.35:
+    mov rcx, 12
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cdiv.38
+.L.bb.cdiv.37:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    mov rax, 5270498306774157605
+    imul rcx
+    sar rdx, 1
+    mov rcx, rdx
+    shr rcx, 63
+    add rcx, rdx
+    mov rax, rcx
+    jmp .L.return.cdiv
+.L.bb.cdiv.39:
+.L.bb.cdiv.38:
+    mov rcx, 13
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cdiv.41
+.L.bb.cdiv.40:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    mov rax, -5270498306774157605
+    imul rcx
+    sar rdx, 1
+    mov rcx, rdx
+    shr rcx, 63
+    add rcx, rdx
+    mov rax, rcx
+    jmp .L.return.cdiv
+.L.bb.cdiv.42:
+.L.bb.cdiv.41:
+    mov rcx, 14
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cdiv.44
+.L.bb.cdiv.43:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    mov rsi, rcx
+    sar rsi, 63
+    shr rsi, 61
+    add rsi, rcx
+    sar rsi, 3
+    mov rax, rsi
+    jmp .L.return.cdiv
+.L.bb.cdiv.45:
+.L.bb.cdiv.44:
+    mov rcx, 15
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cdiv.47
+.L.bb.cdiv.46:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    mov rsi, rcx
+    sar rsi, 63
+    shr rsi, 61
+    add rsi, rcx
+    sar rsi, 3
+    neg rsi
+    mov rax, rsi
+    jmp .L.return.cdiv
+.L.bb.cdiv.48:
+.L.bb.cdiv.47:
+    mov rcx, 16
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cdiv.50
+.L.bb.cdiv.49:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    mov rax, 2049638230412172402
+    imul rcx
+    mov rcx, rdx
+    shr rcx, 63
+    add rcx, rdx
+    mov rax, rcx
+    jmp .L.return.cdiv
+.L.bb.cdiv.51:
+.L.bb.cdiv.50:
+    mov rcx, 17
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cdiv.53
+.L.bb.cdiv.52:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    mov rax, 2049638230412172401
+    imul rcx
+    sub rdx, rcx
+    sar rdx, 3
+    mov rcx, rdx
+    shr rcx, 63
+    add rcx, rdx
+    mov rax, rcx
+    jmp .L.return.cdiv
+.L.bb.cdiv.54:
+.L.bb.cdiv.53:
+    mov rcx, 18
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cdiv.56
+.L.bb.cdiv.55:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    mov rax, 7378697629483820647
+    imul rcx
+    sar rdx, 2
+    mov rcx, rdx
+    shr rcx, 63
+    add rcx, rdx
+    mov rax, rcx
+    jmp .L.return.cdiv
+.L.bb.cdiv.57:
+.L.bb.cdiv.56:
+    mov rcx, 19
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cdiv.59
+.L.bb.cdiv.58:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    mov rax, -7378697629483820647
+    imul rcx
+    sar rdx, 2
+    mov rcx, rdx
+    shr rcx, 63
+    add rcx, rdx
+    mov rax, rcx
+    jmp .L.return.cdiv
+.L.bb.cdiv.60:
+.L.bb.cdiv.59:
+    mov rcx, 20
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cdiv.62
+.L.bb.cdiv.61:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    mov rax, 3353953467947191203
+    imul rcx
+    sar rdx, 1
+    mov rcx, rdx
+    shr rcx, 63
+    add rcx, rdx
+    mov rax, rcx
+    jmp .L.return.cdiv
+.L.bb.cdiv.63:
+.L.bb.cdiv.62:
+    mov rcx, 21
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cdiv.65
+.L.bb.cdiv.64:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    mov rax, -3353953467947191203
+    imul rcx
+    sar rdx, 1
+    mov rcx, rdx
+    shr rcx, 63
+    add rcx, rdx
+    mov rax, rcx
+    jmp .L.return.cdiv
+.L.bb.cdiv.66:
+.L.bb.cdiv.65:
+    mov rcx, 22
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cdiv.68
+.L.bb.cdiv.67:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    mov rax, 3074457345618258603
+    imul rcx
+    sar rdx, 1
+    mov rcx, rdx
+    shr rcx, 63
+    add rcx, rdx
+    mov rax, rcx
+    jmp .L.return.cdiv
+.L.bb.cdiv.69:
+.L.bb.cdiv.68:
+    mov rcx, 23
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cdiv.71
+.L.bb.cdiv.70:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    mov rax, -3074457345618258603
+    imul rcx
+    sar rdx, 1
+    mov rcx, rdx
+    shr rcx, 63
+    add rcx, rdx
+    mov rax, rcx
+    jmp .L.return.cdiv
+.L.bb.cdiv.72:
+.L.bb.cdiv.71:
+    mov rcx, 24
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cdiv.74
+.L.bb.cdiv.73:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    mov rax, 5675921253449092805
+    imul rcx
+    sar rdx, 2
+    mov rcx, rdx
+    shr rcx, 63
+    add rcx, rdx
+    mov rax, rcx
+    jmp .L.return.cdiv
+.L.bb.cdiv.75:
+.L.bb.cdiv.74:
+    mov rcx, 25
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cdiv.77
+.L.bb.cdiv.76:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    mov rax, -5675921253449092805
+    imul rcx
+    sar rdx, 2
+    mov rcx, rdx
+    shr rcx, 63
+    add rcx, rdx
+    mov rax, rcx
+    jmp .L.return.cdiv
+.L.bb.cdiv.78:
+.L.bb.cdiv.77:
+    mov rcx, 26
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cdiv.80
+.L.bb.cdiv.79:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    mov rax, -8608480567731124087
+    imul rcx
+    add rdx, rcx
+    sar rdx, 3
+    mov rcx, rdx
+    shr rcx, 63
+    add rcx, rdx
+    mov rax, rcx
+    jmp .L.return.cdiv
+.L.bb.cdiv.81:
+.L.bb.cdiv.80:
+    mov rcx, 27
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cdiv.83
+.L.bb.cdiv.82:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    mov rax, 8608480567731124087
+    imul rcx
+    sub rdx, rcx
+    sar rdx, 3
+    mov rcx, rdx
+    shr rcx, 63
+    add rcx, rdx
+    mov rax, rcx
+    jmp .L.return.cdiv
+.L.bb.cdiv.84:
+.L.bb.cdiv.83:
+    mov rcx, 28
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cdiv.86
+.L.bb.cdiv.85:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    mov rsi, rcx
+    sar rsi, 63
+    shr rsi, 60
+    add rsi, rcx
+    sar rsi, 4
+    mov rax, rsi
+    jmp .L.return.cdiv
+.L.bb.cdiv.87:
+.L.bb.cdiv.86:
+    mov rcx, 29
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cdiv.89
+.L.bb.cdiv.88:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    mov rsi, rcx
+    sar rsi, 63
+    shr rsi, 60
+    add rsi, rcx
+    sar rsi, 4
+    neg rsi
+    mov rax, rsi
+    jmp .L.return.cdiv
+.L.bb.cdiv.90:
+.L.bb.cdiv.89:
+    mov rcx, 30
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cdiv.92
+.L.bb.cdiv.91:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    mov rax, 8680820740569200761
+    imul rcx
+    sar rdx, 3
+    mov rcx, rdx
+    shr rcx, 63
+    add rcx, rdx
+    mov rax, rcx
+    jmp .L.return.cdiv
+.L.bb.cdiv.93:
+.L.bb.cdiv.92:
+    mov rcx, 31
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cdiv.95
+.L.bb.cdiv.94:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    mov rax, -8680820740569200761
+    imul rcx
+    sar rdx, 3
+    mov rcx, rdx
+    shr rcx, 63
+    add rcx, rdx
+    mov rax, rcx
+    jmp .L.return.cdiv
+.L.bb.cdiv.96:
+.L.bb.cdiv.95:
+    mov rcx, 32
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cdiv.98
+.L.bb.cdiv.97:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    mov rax, 3074457345618258603
+    imul rcx
+    sar rdx, 2
+    mov rcx, rdx
+    shr rcx, 63
+    add rcx, rdx
+    mov rax, rcx
+    jmp .L.return.cdiv
+.L.bb.cdiv.99:
+.L.bb.cdiv.98:
+    mov rcx, 33
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cdiv.101
+.L.bb.cdiv.100:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    mov rax, -3074457345618258603
+    imul rcx
+    sar rdx, 2
+    mov rcx, rdx
+    shr rcx, 63
+    add rcx, rdx
+    mov rax, rcx
+    jmp .L.return.cdiv
+.L.bb.cdiv.102:
+.L.bb.cdiv.101:
+    mov rcx, 34
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cdiv.104
+.L.bb.cdiv.103:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    mov rax, -6640827866535438581
+    imul rcx
+    add rdx, rcx
+    sar rdx, 4
+    mov rcx, rdx
+    shr rcx, 63
+    add rcx, rdx
+    mov rax, rcx
+    jmp .L.return.cdiv
+.L.bb.cdiv.105:
+.L.bb.cdiv.104:
+    mov rcx, 35
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cdiv.107
+.L.bb.cdiv.106:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    mov rax, 6640827866535438581
+    imul rcx
+    sub rdx, rcx
+    sar rdx, 4
+    mov rcx, rdx
+    shr rcx, 63
+    add rcx, rdx
+    mov rax, rcx
+    jmp .L.return.cdiv
+.L.bb.cdiv.108:
+.L.bb.cdiv.107:
+    mov rcx, 36
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cdiv.110
+.L.bb.cdiv.109:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    mov rax, -8925843906633654007
+    imul rcx
+    add rdx, rcx
+    sar rdx, 4
+    mov rcx, rdx
+    shr rcx, 63
+    add rcx, rdx
+    mov rax, rcx
+    jmp .L.return.cdiv
+.L.bb.cdiv.111:
+.L.bb.cdiv.110:
+    mov rcx, 37
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cdiv.113
+.L.bb.cdiv.112:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    mov rax, 8925843906633654007
+    imul rcx
+    sub rdx, rcx
+    sar rdx, 4
+    mov rcx, rdx
+    shr rcx, 63
+    add rcx, rdx
+    mov rax, rcx
+    jmp .L.return.cdiv
+.L.bb.cdiv.114:
+.L.bb.cdiv.113:
+    mov rcx, 38
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cdiv.116
+.L.bb.cdiv.115:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    mov rsi, rcx
+    sar rsi, 63
+    shr rsi, 59
+    add rsi, rcx
+    sar rsi, 5
+    mov rax, rsi
+    jmp .L.return.cdiv
+.L.bb.cdiv.117:
+.L.bb.cdiv.116:
+    mov rcx, 39
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cdiv.119
+.L.bb.cdiv.118:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    mov rsi, rcx
+    sar rsi, 63
+    shr rsi, 59
+    add rsi, rcx
+    sar rsi, 5
+    neg rsi
+    mov rax, rsi
+    jmp .L.return.cdiv
+.L.bb.cdiv.120:
+.L.bb.cdiv.119:
+    mov rcx, 40
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cdiv.122
+.L.bb.cdiv.121:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    mov rax, 1024819115206086201
+    imul rcx
+    sar rdx, 1
+    mov rcx, rdx
+    shr rcx, 63
+    add rcx, rdx
+    mov rax, rcx
+    jmp .L.return.cdiv
+.L.bb.cdiv.123:
+.L.bb.cdiv.122:
+    mov rcx, 41
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cdiv.125
+.L.bb.cdiv.124:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    mov rax, -1024819115206086201
+    imul rcx
+    sar rdx, 1
+    mov rcx, rdx
+    shr rcx, 63
+    add rcx, rdx
+    mov rax, rcx
+    jmp .L.return.cdiv
+.L.bb.cdiv.126:
+.L.bb.cdiv.125:
+    mov rcx, 42
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cdiv.128
+.L.bb.cdiv.127:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    mov rax, 7378697629483820647
+    imul rcx
+    sar rdx, 4
+    mov rcx, rdx
+    shr rcx, 63
+    add rcx, rdx
+    mov rax, rcx
+    jmp .L.return.cdiv
+.L.bb.cdiv.129:
+.L.bb.cdiv.128:
+    mov rcx, 43
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cdiv.131
+.L.bb.cdiv.130:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    mov rax, -7378697629483820647
+    imul rcx
+    sar rdx, 4
+    mov rcx, rdx
+    shr rcx, 63
+    add rcx, rdx
+    mov rax, rcx
+    jmp .L.return.cdiv
+.L.bb.cdiv.132:
+.L.bb.cdiv.131:
+    mov rcx, 44
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cdiv.134
+.L.bb.cdiv.133:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    mov rax, 3279421168659475843
+    imul rcx
+    sar rdx, 3
+    mov rcx, rdx
+    shr rcx, 63
+    add rcx, rdx
+    mov rax, rcx
+    jmp .L.return.cdiv
+.L.bb.cdiv.135:
+.L.bb.cdiv.134:
+    mov rcx, 45
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cdiv.137
+.L.bb.cdiv.136:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    mov rax, -3279421168659475843
+    imul rcx
+    sar rdx, 3
+    mov rcx, rdx
+    shr rcx, 63
+    add rcx, rdx
+    mov rax, rcx
+    jmp .L.return.cdiv
+.L.bb.cdiv.138:
+.L.bb.cdiv.137:
+    mov rcx, 46
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cdiv.140
+.L.bb.cdiv.139:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    mov rax, -9076969306111049207
+    imul rcx
+    add rdx, rcx
+    sar rdx, 5
+    mov rcx, rdx
+    shr rcx, 63
+    add rcx, rdx
+    mov rax, rcx
+    jmp .L.return.cdiv
+.L.bb.cdiv.141:
+.L.bb.cdiv.140:
+    mov rcx, 47
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cdiv.143
+.L.bb.cdiv.142:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    mov rax, 9076969306111049207
+    imul rcx
+    sub rdx, rcx
+    sar rdx, 5
+    mov rcx, rdx
+    shr rcx, 63
+    add rcx, rdx
+    mov rax, rcx
+    jmp .L.return.cdiv
+.L.bb.cdiv.144:
+.L.bb.cdiv.143:
+    mov rcx, 48
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cdiv.146
+.L.bb.cdiv.145:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    mov rsi, rcx
+    sar rsi, 63
+    shr rsi, 58
+    add rsi, rcx
+    sar rsi, 6
+    mov rax, rsi
+    jmp .L.return.cdiv
+.L.bb.cdiv.147:
+.L.bb.cdiv.146:
+    mov rcx, 49
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cdiv.149
+.L.bb.cdiv.148:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    mov rsi, rcx
+    sar rsi, 63
+    shr rsi, 58
+    add rsi, rcx
+    sar rsi, 6
+    neg rsi
+    mov rax, rsi
+    jmp .L.return.cdiv
+.L.bb.cdiv.150:
+.L.bb.cdiv.149:
+    mov rcx, 50
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cdiv.152
+.L.bb.cdiv.151:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    mov rax, 1024819115206086201
+    imul rcx
+    sar rdx, 2
+    mov rcx, rdx
+    shr rcx, 63
+    add rcx, rdx
+    mov rax, rcx
+    jmp .L.return.cdiv
+.L.bb.cdiv.153:
+.L.bb.cdiv.152:
+    mov rcx, 51
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cdiv.155
+.L.bb.cdiv.154:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    mov rax, -1024819115206086201
+    imul rcx
+    sar rdx, 2
+    mov rcx, rdx
+    shr rcx, 63
+    add rcx, rdx
+    mov rax, rcx
+    jmp .L.return.cdiv
+.L.bb.cdiv.156:
+.L.bb.cdiv.155:
+    mov rcx, 52
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cdiv.158
+.L.bb.cdiv.157:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    mov rax, -6640827866535438581
+    imul rcx
+    add rdx, rcx
+    sar rdx, 6
+    mov rcx, rdx
+    shr rcx, 63
+    add rcx, rdx
+    mov rax, rcx
+    jmp .L.return.cdiv
+.L.bb.cdiv.159:
+.L.bb.cdiv.158:
+    mov rcx, 53
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cdiv.161
+.L.bb.cdiv.160:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    mov rax, 6640827866535438581
+    imul rcx
+    sub rdx, rcx
+    sar rdx, 6
+    mov rcx, rdx
+    shr rcx, 63
+    add rcx, rdx
+    mov rax, rcx
+    jmp .L.return.cdiv
+.L.bb.cdiv.162:
+.L.bb.cdiv.161:
+    mov rcx, 54
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cdiv.164
+.L.bb.cdiv.163:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    mov rax, 4647998506761461825
+    imul rcx
+    sar rdx, 5
+    mov rcx, rdx
+    shr rcx, 63
+    add rcx, rdx
+    mov rax, rcx
+    jmp .L.return.cdiv
+.L.bb.cdiv.165:
+.L.bb.cdiv.164:
+    mov rcx, 55
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cdiv.167
+.L.bb.cdiv.166:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    mov rax, -4647998506761461825
+    imul rcx
+    sar rdx, 5
+    mov rcx, rdx
+    shr rcx, 63
+    add rcx, rdx
+    mov rax, rcx
+    jmp .L.return.cdiv
+.L.bb.cdiv.168:
+.L.bb.cdiv.167:
+    mov rcx, 56
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cdiv.170
+.L.bb.cdiv.169:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    mov rsi, rcx
+    sar rsi, 63
+    shr rsi, 57
+    add rsi, rcx
+    sar rsi, 7
+    mov rax, rsi
+    jmp .L.return.cdiv
+.L.bb.cdiv.171:
+.L.bb.cdiv.170:
+    mov rcx, 57
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cdiv.173
+.L.bb.cdiv.172:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    mov rsi, rcx
+    sar rsi, 63
+    shr rsi, 57
+    add rsi, rcx
+    sar rsi, 7
+    neg rsi
+    mov rax, rsi
+    jmp .L.return.cdiv
+.L.bb.cdiv.174:
+.L.bb.cdiv.173:
+    mov rcx, 58
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cdiv.176
+.L.bb.cdiv.175:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    mov rax, -9187201950435737471
+    imul rcx
+    add rdx, rcx
+    sar rdx, 7
+    mov rcx, rdx
+    shr rcx, 63
+    add rcx, rdx
+    mov rax, rcx
+    jmp .L.return.cdiv
+.L.bb.cdiv.177:
+.L.bb.cdiv.176:
+    mov rcx, 59
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cdiv.179
+.L.bb.cdiv.178:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    mov rax, 9187201950435737471
+    imul rcx
+    sub rdx, rcx
+    sar rdx, 7
+    mov rcx, rdx
+    shr rcx, 63
+    add rcx, rdx
+    mov rax, rcx
+    jmp .L.return.cdiv
+.L.bb.cdiv.180:
+.L.bb.cdiv.179:
+    mov rcx, 60
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cdiv.182
+.L.bb.cdiv.181:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    mov rax, 7367186400732675841
+    imul rcx
+    sar rdx, 8
+    mov rcx, rdx
+    shr rcx, 63
+    add rcx, rdx
+    mov rax, rcx
+    jmp .L.return.cdiv
+.L.bb.cdiv.183:
+.L.bb.cdiv.182:
+    mov rcx, 61
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cdiv.185
+.L.bb.cdiv.184:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    mov rax, -7367186400732675841
+    imul rcx
+    sar rdx, 8
+    mov rcx, rdx
+    shr rcx, 63
+    add rcx, rdx
+    mov rax, rcx
+    jmp .L.return.cdiv
+.L.bb.cdiv.186:
+.L.bb.cdiv.185:
+    mov rcx, 62
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cdiv.188
+.L.bb.cdiv.187:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    mov rax, 2361183241434822607
+    imul rcx
+    sar rdx, 7
+    mov rcx, rdx
+    shr rcx, 63
+    add rcx, rdx
+    mov rax, rcx
+    jmp .L.return.cdiv
+.L.bb.cdiv.189:
+.L.bb.cdiv.188:
+    mov rcx, 63
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cdiv.191
+.L.bb.cdiv.190:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    mov rax, -2361183241434822607
+    imul rcx
+    sar rdx, 7
+    mov rcx, rdx
+    shr rcx, 63
+    add rcx, rdx
+    mov rax, rcx
+    jmp .L.return.cdiv
+.L.bb.cdiv.192:
+.L.bb.cdiv.191:
+    mov rcx, 64
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cdiv.194
+.L.bb.cdiv.193:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    mov rsi, rcx
+    sar rsi, 63
+    shr rsi, 52
+    add rsi, rcx
+    sar rsi, 12
+    mov rax, rsi
+    jmp .L.return.cdiv
+.L.bb.cdiv.195:
+.L.bb.cdiv.194:
+    mov rcx, 65
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cdiv.197
+.L.bb.cdiv.196:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    mov rsi, rcx
+    sar rsi, 63
+    shr rsi, 52
+    add rsi, rcx
+    sar rsi, 12
+    neg rsi
+    mov rax, rsi
+    jmp .L.return.cdiv
+.L.bb.cdiv.198:
+.L.bb.cdiv.197:
+    mov rcx, 66
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cdiv.200
+.L.bb.cdiv.199:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    mov rax, 9223231301513871361
+    imul rcx
+    sar rdx, 15
+    mov rcx, rdx
+    shr rcx, 63
+    add rcx, rdx
+    mov rax, rcx
+    jmp .L.return.cdiv
+.L.bb.cdiv.201:
+.L.bb.cdiv.200:
+    mov rcx, 67
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cdiv.203
+.L.bb.cdiv.202:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    mov rax, -9223231301513871361
+    imul rcx
+    sar rdx, 15
+    mov rcx, rdx
+    shr rcx, 63
+    add rcx, rdx
+    mov rax, rcx
+    jmp .L.return.cdiv
+.L.bb.cdiv.204:
+.L.bb.cdiv.203:
+    mov rcx, 68
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cdiv.206
+.L.bb.cdiv.205:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    mov rax, -6899514631820148735
+    imul rcx
+    add rdx, rcx
+    sar rdx, 22
+    mov rcx, rdx
+    shr rcx, 63
+    add rcx, rdx
+    mov rax, rcx
+    jmp .L.return.cdiv
+.L.bb.cdiv.207:
+.L.bb.cdiv.206:
+    mov rcx, 69
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cdiv.209
+.L.bb.cdiv.208:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    mov rax, 6899514631820148735
+    imul rcx
+    sub rdx, rcx
+    sar rdx, 22
+    mov rcx, rdx
+    shr rcx, 63
+    add rcx, rdx
+    mov rax, rcx
+    jmp .L.return.cdiv
+.L.bb.cdiv.210:
+.L.bb.cdiv.209:
+    mov rcx, 70
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cdiv.212
+.L.bb.cdiv.211:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    mov rax, -8543223828751151131
+    imul rcx
+    add rdx, rcx
+    sar rdx, 29
+    mov rcx, rdx
+    shr rcx, 63
+    add rcx, rdx
+    mov rax, rcx
+    jmp .L.return.cdiv
+.L.bb.cdiv.213:
+.L.bb.cdiv.212:
+    mov rcx, 71
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cdiv.215
+.L.bb.cdiv.214:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    mov rax, 8543223828751151131
+    imul rcx
+    sub rdx, rcx
+    sar rdx, 29
+    mov rcx, rdx
+    shr rcx, 63
+    add rcx, rdx
+    mov rax, rcx
+    jmp .L.return.cdiv
+.L.bb.cdiv.216:
+.L.bb.cdiv.215:
+    mov rcx, 72
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cdiv.218
+.L.bb.cdiv.217:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    mov rax, -9223372032559808509
+    imul rcx
+    add rdx, rcx
+    sar rdx, 30
+    mov rcx, rdx
+    shr rcx, 63
+    add rcx, rdx
+    mov rax, rcx
+    jmp .L.return.cdiv
+.L.bb.cdiv.219:
+.L.bb.cdiv.218:
+    mov rcx, 73
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cdiv.221
+.L.bb.cdiv.220:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    mov rax, 9223372032559808509
+    imul rcx
+    sub rdx, rcx
+    sar rdx, 30
+    mov rcx, rdx
+    shr rcx, 63
+    add rcx, rdx
+    mov rax, rcx
+    jmp .L.return.cdiv
+.L.bb.cdiv.222:
+.L.bb.cdiv.221:
+    mov rcx, 74
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cdiv.224
+.L.bb.cdiv.223:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    mov rsi, rcx
+    sar rsi, 63
+    shr rsi, 33
+    add rsi, rcx
+    sar rsi, 31
+    mov rax, rsi
+    jmp .L.return.cdiv
+.L.bb.cdiv.225:
+.L.bb.cdiv.224:
+    mov rcx, 75
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cdiv.227
+.L.bb.cdiv.226:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    mov rsi, rcx
+    sar rsi, 63
+    shr rsi, 33
+    add rsi, rcx
+    sar rsi, 31
+    neg rsi
+    mov rax, rsi
+    jmp .L.return.cdiv
+.L.bb.cdiv.228:
+.L.bb.cdiv.227:
+    mov rcx, 76
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cdiv.230
+.L.bb.cdiv.229:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    mov rsi, rcx
+    sar rsi, 63
+    shr rsi, 32
+    add rsi, rcx
+    sar rsi, 32
+    mov rax, rsi
+    jmp .L.return.cdiv
+.L.bb.cdiv.231:
+.L.bb.cdiv.230:
+    mov rcx, 77
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cdiv.233
+.L.bb.cdiv.232:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    mov rsi, rcx
+    sar rsi, 63
+    shr rsi, 32
+    add rsi, rcx
+    sar rsi, 32
+    neg rsi
+    mov rax, rsi
+    jmp .L.return.cdiv
+.L.bb.cdiv.234:
+.L.bb.cdiv.233:
+    mov rcx, 78
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cdiv.236
+.L.bb.cdiv.235:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    mov rsi, rcx
+    sar rsi, 63
+    shr rsi, 24
+    add rsi, rcx
+    sar rsi, 40
+    mov rax, rsi
+    jmp .L.return.cdiv
+.L.bb.cdiv.237:
+.L.bb.cdiv.236:
+    mov rcx, 79
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cdiv.239
+.L.bb.cdiv.238:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    mov rsi, rcx
+    sar rsi, 63
+    shr rsi, 24
+    add rsi, rcx
+    sar rsi, 40
+    neg rsi
+    mov rax, rsi
+    jmp .L.return.cdiv
+.L.bb.cdiv.240:
+.L.bb.cdiv.239:
+    mov rcx, 80
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cdiv.242
+.L.bb.cdiv.241:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    mov rsi, rcx
+    sar rsi, 63
+    shr rsi, 2
+    add rsi, rcx
+    sar rsi, 62
+    mov rax, rsi
+    jmp .L.return.cdiv
+.L.bb.cdiv.243:
+.L.bb.cdiv.242:
+    mov rcx, 81
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cdiv.245
+.L.bb.cdiv.244:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    mov rsi, rcx
+    sar rsi, 63
+    shr rsi, 2
+    add rsi, rcx
+    sar rsi, 62
+    neg rsi
+    mov rax, rsi
+    jmp .L.return.cdiv
+.L.bb.cdiv.246:
+.L.bb.cdiv.245:
+    mov rcx, 82
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cdiv.248
+.L.bb.cdiv.247:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    mov rax, 4611686018427387905
+    imul rcx
+    sar rdx, 61
+    mov rcx, rdx
+    shr rcx, 63
+    add rcx, rdx
+    mov rax, rcx
+    jmp .L.return.cdiv
+.L.bb.cdiv.249:
+.L.bb.cdiv.248:
+    mov rcx, 83
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cdiv.251
+.L.bb.cdiv.250:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    mov rax, -4611686018427387905
+    imul rcx
+    sar rdx, 61
+    mov rcx, rdx
+    shr rcx, 63
+    add rcx, rdx
+    mov rax, rcx
+    jmp .L.return.cdiv
+.L.bb.cdiv.252:
+.L.bb.cdiv.251:
+    mov rcx, 84
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cdiv.254
+.L.bb.cdiv.253:
+    mov rcx, -9223372036854775808
+    lea rsi, [rbp - 8]
+    mov rsi, [rsi]
+    mov rax, rsi
+    cqo
+    idiv rcx
+    mov rcx, rax
+    mov rax, rcx
+    jmp .L.return.cdiv
+.L.bb.cdiv.255:
+.L.bb.cdiv.254:
+    mov rcx, 85
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cdiv.257
+.L.bb.cdiv.256:
+    mov rcx, -9223372036854775808
+    lea rsi, [rbp - 8]
+    mov rsi, [rsi]
+    mov rax, rsi
+    cqo
+    idiv rcx
+    mov rcx, rax
+    mov rax, rcx
+    jmp .L.return.cdiv
+.L.bb.cdiv.258:
+.L.bb.cdiv.257:
+    mov rcx, 0
+    mov rax, rcx
+.L.return.cdiv:
+    mov rsp, rbp
+    pop rbp
+    ret
+    .globl cmul
+    .text
+cmul:
+    push rbp
+    mov rbp, rsp
+    sub rsp, 16
+    mov [rbp - 8], rdi
+    mov [rbp - 16], rsi
+.L.bb.cmul.0:
+    mov rcx, 0
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.2
+.L.bb.cmul.1:
+    mov rcx, 0
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.3:
+.L.bb.cmul.2:
+    mov rcx, 1
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.5
+.L.bb.cmul.4:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.6:
+.L.bb.cmul.5:
+    mov rcx, 2
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.8
+.L.bb.cmul.7:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.9:
+.L.bb.cmul.8:
+    mov rcx, 3
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.11
+.L.bb.cmul.10:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    neg rcx
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.12:
+.L.bb.cmul.11:
+    mov rcx, 4
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.14
+.L.bb.cmul.13:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    neg rcx
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.15:
+.L.bb.cmul.14:
+    mov rcx, 5
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.17
+.L.bb.cmul.16:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    shl rcx, 1
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.18:
+.L.bb.cmul.17:
+    mov rcx, 6
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.20
+.L.bb.cmul.19:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    shl rcx, 1
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.21:
+.L.bb.cmul.20:
+    mov rcx, 7
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.23
+.L.bb.cmul.22:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    shl rcx, 1
+    neg rcx
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.24:
+.L.bb.cmul.23:
+    mov rcx, 8
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.26
+.L.bb.cmul.25:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    shl rcx, 1
+    neg rcx
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.27:
+.L.bb.cmul.26:
+    mov rcx, 9
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.29
+.L.bb.cmul.28:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    lea rcx, [rcx + rcx*2]
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.30:
+.L.bb.cmul.29:
+    mov rcx, 10
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.32
+.L.bb.cmul.31:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    lea rcx, [rcx + rcx*2]
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.33:
+.L.bb.cmul.32:
+    mov rcx, 11
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.35
+.L.bb.cmul.34:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    lea rcx, [rcx + rcx*2]
+    neg rcx
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.36:
+.L.bb.cmul.35:
+    mov rcx, 12
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.38
+.L.bb.cmul.37:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    lea rcx, [rcx + rcx*2]
+    neg rcx
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.39:
+.L.bb.cmul.38:
+    mov rcx, 13
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.41
+.L.bb.cmul.40:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    shl rcx, 2
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.42:
+.L.bb.cmul.41:
+    mov rcx, 14
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.44
+.L.bb.cmul.43:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    shl rcx, 2
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.45:
+.L.bb.cmul.44:
+    mov rcx, 15
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.47
+.L.bb.cmul.46:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    shl rcx, 2
+    neg rcx
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.48:
+.L.bb.cmul.47:
+    mov rcx, 16
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.50
+.L.bb.cmul.49:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    shl rcx, 2
+    neg rcx
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.51:
+.L.bb.cmul.50:
+    mov rcx, 17
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.53
+.L.bb.cmul.52:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    lea rcx, [rcx + rcx*4]
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.54:
+.L.bb.cmul.53:
+    mov rcx, 18
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.56
+.L.bb.cmul.55:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    lea rcx, [rcx + rcx*4]
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.57:
+.L.bb.cmul.56:
+    mov rcx, 19
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.59
+.L.bb.cmul.58:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    lea rcx, [rcx + rcx*4]
+    neg rcx
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.60:
+.L.bb.cmul.59:
+    mov rcx, 20
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.62
+.L.bb.cmul.61:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    lea rcx, [rcx + rcx*4]
+    neg rcx
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.63:
+.L.bb.cmul.62:
+    mov rcx, 21
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.65
+.L.bb.cmul.64:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    lea rcx, [rcx + rcx*2]
+    shl rcx, 1
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.66:
+.L.bb.cmul.65:
+    mov rcx, 22
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.68
+.L.bb.cmul.67:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    lea rcx, [rcx + rcx*2]
+    shl rcx, 1
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.69:
+.L.bb.cmul.68:
+    mov rcx, 23
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.71
+.L.bb.cmul.70:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    lea rcx, [rcx + rcx*2]
+    shl rcx, 1
+    neg rcx
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.72:
+.L.bb.cmul.71:
+    mov rcx, 24
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.74
+.L.bb.cmul.73:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    lea rcx, [rcx + rcx*2]
+    shl rcx, 1
+    neg rcx
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.75:
+.L.bb.cmul.74:
+    mov rcx, 25
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.77
+.L.bb.cmul.76:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    imul rcx, 7
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.78:
+.L.bb.cmul.77:
+    mov rcx, 26
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.80
+.L.bb.cmul.79:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    imul rcx, 7
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.81:
+.L.bb.cmul.80:
+    mov rcx, 27
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.83
+.L.bb.cmul.82:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    imul rcx, -7
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.84:
+.L.bb.cmul.83:
+    mov rcx, 28
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.86
+.L.bb.cmul.85:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    imul rcx, -7
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.87:
+.L.bb.cmul.86:
+    mov rcx, 29
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.89
+.L.bb.cmul.88:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    shl rcx, 3
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.90:
+.L.bb.cmul.89:
+    mov rcx, 30
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.92
+.L.bb.cmul.91:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    shl rcx, 3
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.93:
+.L.bb.cmul.92:
+    mov rcx, 31
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.95
+.L.bb.cmul.94:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    shl rcx, 3
+    neg rcx
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.96:
+.L.bb.cmul.95:
+    mov rcx, 32
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.98
+.L.bb.cmul.97:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    shl rcx, 3
+    neg rcx
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.99:
+.L.bb.cmul.98:
+    mov rcx, 33
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.101
+.L.bb.cmul.100:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    lea rcx, [rcx + rcx*8]
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.102:
+.L.bb.cmul.101:
+    mov rcx, 34
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.104
+.L.bb.cmul.103:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    lea rcx, [rcx + rcx*8]
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.105:
+.L.bb.cmul.104:
+    mov rcx, 35
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.107
+.L.bb.cmul.106:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    lea rcx, [rcx + rcx*8]
+    neg rcx
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.108:
+.L.bb.cmul.107:
+    mov rcx, 36
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.110
+.L.bb.cmul.109:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    lea rcx, [rcx + rcx*8]
+    neg rcx
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.111:
+.L.bb.cmul.110:
+    mov rcx, 37
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.113
+.L.bb.cmul.112:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    lea rcx, [rcx + rcx*4]
+    shl rcx, 1
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.114:
+.L.bb.cmul.113:
+    mov rcx, 38
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.116
+.L.bb.cmul.115:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    lea rcx, [rcx + rcx*4]
+    shl rcx, 1
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.117:
+.L.bb.cmul.116:
+    mov rcx, 39
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.119
+.L.bb.cmul.118:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    lea rcx, [rcx + rcx*4]
+    shl rcx, 1
+    neg rcx
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.120:
+.L.bb.cmul.119:
+    mov rcx, 40
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.122
+.L.bb.cmul.121:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    lea rcx, [rcx + rcx*4]
+    shl rcx, 1
+    neg rcx
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.123:
+.L.bb.cmul.122:
+    mov rcx, 41
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.125
+.L.bb.cmul.124:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    imul rcx, 11
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.126:
+.L.bb.cmul.125:
+    mov rcx, 42
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.128
+.L.bb.cmul.127:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    imul rcx, 11
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.129:
+.L.bb.cmul.128:
+    mov rcx, 43
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.131
+.L.bb.cmul.130:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    imul rcx, -11
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.132:
+.L.bb.cmul.131:
+    mov rcx, 44
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.134
+.L.bb.cmul.133:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    imul rcx, -11
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.135:
+.L.bb.cmul.134:
+    mov rcx, 45
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.137
+.L.bb.cmul.136:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    lea rcx, [rcx + rcx*2]
+    shl rcx, 2
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.138:
+.L.bb.cmul.137:
+    mov rcx, 46
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.140
+.L.bb.cmul.139:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    lea rcx, [rcx + rcx*2]
+    shl rcx, 2
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.141:
+.L.bb.cmul.140:
+    mov rcx, 47
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.143
+.L.bb.cmul.142:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    lea rcx, [rcx + rcx*2]
+    shl rcx, 2
+    neg rcx
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.144:
+.L.bb.cmul.143:
+    mov rcx, 48
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.146
+.L.bb.cmul.145:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    lea rcx, [rcx + rcx*2]
+    shl rcx, 2
+    neg rcx
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.147:
+.L.bb.cmul.146:
+    mov rcx, 49
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.149
+.L.bb.cmul.148:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    imul rcx, 13
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.150:
+.L.bb.cmul.149:
+    mov rcx, 50
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.152
+.L.bb.cmul.151:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    imul rcx, 13
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.153:
+.L.bb.cmul.152:
+    mov rcx, 51
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.155
+.L.bb.cmul.154:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    imul rcx, -13
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.156:
+.L.bb.cmul.155:
+    mov rcx, 52
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.158
+.L.bb.cmul.157:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    imul rcx, -13
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.159:
+.L.bb.cmul.158:
+    mov rcx, 53
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.161
+.L.bb.cmul.160:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    imul rcx, 15
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.162:
+.L.bb.cmul.161:
+    mov rcx, 54
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.164
+.L.bb.cmul.163:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    imul rcx, 15
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.165:
+.L.bb.cmul.164:
+    mov rcx, 55
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.167
+.L.bb.cmul.166:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    imul rcx, -15
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.168:
+.L.bb.cmul.167:
+    mov rcx, 56
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.170
+.L.bb.cmul.169:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    imul rcx, -15
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.171:
+.L.bb.cmul.170:
+    mov rcx, 57
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.173
+.L.bb.cmul.172:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    shl rcx, 4
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.174:
+.L.bb.cmul.173:
+    mov rcx, 58
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.176
+.L.bb.cmul.175:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    shl rcx, 4
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.177:
+.L.bb.cmul.176:
+    mov rcx, 59
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.179
+.L.bb.cmul.178:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    shl rcx, 4
+    neg rcx
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.180:
+.L.bb.cmul.179:
+    mov rcx, 60
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.182
+.L.bb.cmul.181:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    shl rcx, 4
+    neg rcx
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.183:
+.L.bb.cmul.182:
+    mov rcx, 61
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.185
+.L.bb.cmul.184:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    imul rcx, 17
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.186:
+.L.bb.cmul.185:
+    mov rcx, 62
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.188
+.L.bb.cmul.187:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    imul rcx, 17
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.189:
+.L.bb.cmul.188:
+    mov rcx, 63
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.191
+.L.bb.cmul.190:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    imul rcx, -17
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.192:
+.L.bb.cmul.191:
+    mov rcx, 64
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.194
+.L.bb.cmul.193:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    imul rcx, -17
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.195:
+.L.bb.cmul.194:
+    mov rcx, 65
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.197
+.L.bb.cmul.196:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    lea rcx, [rcx + rcx*2]
+    shl rcx, 3
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.198:
+.L.bb.cmul.197:
+    mov rcx, 66
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.200
+.L.bb.cmul.199:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    lea rcx, [rcx + rcx*2]
+    shl rcx, 3
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.201:
+.L.bb.cmul.200:
+    mov rcx, 67
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.203
+.L.bb.cmul.202:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    lea rcx, [rcx + rcx*2]
+    shl rcx, 3
+    neg rcx
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.204:
+.L.bb.cmul.203:
+    mov rcx, 68
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.206
+.L.bb.cmul.205:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    lea rcx, [rcx + rcx*2]
+    shl rcx, 3
+    neg rcx
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.207:
+.L.bb.cmul.206:
+    mov rcx, 69
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.209
+.L.bb.cmul.208:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    imul rcx, 25
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.210:
+.L.bb.cmul.209:
+    mov rcx, 70
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.212
+.L.bb.cmul.211:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    imul rcx, 25
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.213:
+.L.bb.cmul.212:
+    mov rcx, 71
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.215
+.L.bb.cmul.214:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    imul rcx, -25
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.216:
+.L.bb.cmul.215:
+    mov rcx, 72
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.218
+.L.bb.cmul.217:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    imul rcx, -25
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.219:
+.L.bb.cmul.218:
+    mov rcx, 73
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.221
+.L.bb.cmul.220:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    imul rcx, 31
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.222:
+.L.bb.cmul.221:
+    mov rcx, 74
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.224
+.L.bb.cmul.223:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    imul rcx, 31
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.225:
+.L.bb.cmul.224:
+    mov rcx, 75
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.227
+.L.bb.cmul.226:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    imul rcx, -31
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.228:
+.L.bb.cmul.227:
+    mov rcx, 76
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.230
+.L.bb.cmul.229:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    imul rcx, -31
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.231:
+.L.bb.cmul.230:
+    mov rcx, 77
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.233
+.L.bb.cmul.232:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    shl rcx, 5
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.234:
+.L.bb.cmul.233:
+    mov rcx, 78
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.236
+.L.bb.cmul.235:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    shl rcx, 5
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.237:
+.L.bb.cmul.236:
+    mov rcx, 79
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.239
+.L.bb.cmul.238:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    shl rcx, 5
+    neg rcx
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.240:
+.L.bb.cmul.239:
+    mov rcx, 80
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.242
+.L.bb.cmul.241:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    shl rcx, 5
+    neg rcx
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.243:
+.L.bb.cmul.242:
+    mov rcx, 81
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.245
+.L.bb.cmul.244:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    lea rcx, [rcx + rcx*8]
+    shl rcx, 2
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.246:
+.L.bb.cmul.245:
+    mov rcx, 82
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.248
+.L.bb.cmul.247:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    lea rcx, [rcx + rcx*8]
+    shl rcx, 2
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.249:
+.L.bb.cmul.248:
+    mov rcx, 83
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.251
+.L.bb.cmul.250:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    lea rcx, [rcx + rcx*8]
+    shl rcx, 2
+    neg rcx
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.252:
+.L.bb.cmul.251:
+    mov rcx, 84
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.254
+.L.bb.cmul.253:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    lea rcx, [rcx + rcx*8]
+    shl rcx, 2
+    neg rcx
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.255:
+.L.bb.cmul.254:
+    mov rcx, 85
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.257
+.L.bb.cmul.256:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    lea rcx, [rcx + rcx*4]
+    shl rcx, 3
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.258:
+.L.bb.cmul.257:
+    mov rcx, 86
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.260
+.L.bb.cmul.259:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    lea rcx, [rcx + rcx*4]
+    shl rcx, 3
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.261:
+.L.bb.cmul.260:
+    mov rcx, 87
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.263
+.L.bb.cmul.262:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    lea rcx, [rcx + rcx*4]
+    shl rcx, 3
+    neg rcx
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.264:
+.L.bb.cmul.263:
+    mov rcx, 88
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.266
+.L.bb.cmul.265:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    lea rcx, [rcx + rcx*4]
+    shl rcx, 3
+    neg rcx
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.267:
+.L.bb.cmul.266:
+    mov rcx, 89
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.269
+.L.bb.cmul.268:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    imul rcx, 45
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.270:
+.L.bb.cmul.269:
+    mov rcx, 90
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.272
+.L.bb.cmul.271:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    imul rcx, 45
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.273:
+.L.bb.cmul.272:
+    mov rcx, 91
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.275
+.L.bb.cmul.274:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    imul rcx, -45
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.276:
+.L.bb.cmul.275:
+    mov rcx, 92
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.278
+.L.bb.cmul.277:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    imul rcx, -45
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.279:
+.L.bb.cmul.278:
+    mov rcx, 93
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.281
+.L.bb.cmul.280:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    imul rcx, 63
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.282:
+.L.bb.cmul.281:
+    mov rcx, 94
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.284
+.L.bb.cmul.283:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    imul rcx, 63
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.285:
+.L.bb.cmul.284:
+    mov rcx, 95
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.287
+.L.bb.cmul.286:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    imul rcx, -63
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.288:
+.L.bb.cmul.287:
+    mov rcx, 96
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.290
+.L.bb.cmul.289:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    imul rcx, -63
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.291:
+.L.bb.cmul.290:
+    mov rcx, 97
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.293
+.L.bb.cmul.292:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    shl rcx, 6
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.294:
+.L.bb.cmul.293:
+    mov rcx, 98
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.296
+.L.bb.cmul.295:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    shl rcx, 6
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.297:
+.L.bb.cmul.296:
+    mov rcx, 99
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.299
+.L.bb.cmul.298:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    shl rcx, 6
+    neg rcx
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.300:
+.L.bb.cmul.299:
+    mov rcx, 100
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.302
+.L.bb.cmul.301:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    shl rcx, 6
+    neg rcx
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.303:
+.L.bb.cmul.302:
+    mov rcx, 101
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.305
+.L.bb.cmul.304:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    lea rcx, [rcx + rcx*8]
+    shl rcx, 3
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.306:
+.L.bb.cmul.305:
+    mov rcx, 102
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.308
+.L.bb.cmul.307:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    lea rcx, [rcx + rcx*8]
+    shl rcx, 3
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.309:
+.L.bb.cmul.308:
+    mov rcx, 103
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.311
+.L.bb.cmul.310:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    lea rcx, [rcx + rcx*8]
+    shl rcx, 3
+    neg rcx
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.312:
+.L.bb.cmul.311:
+    mov rcx, 104
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.314
+.L.bb.cmul.313:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    lea rcx, [rcx + rcx*8]
+    shl rcx, 3
+    neg rcx
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.315:
+.L.bb.cmul.314:
+    mov rcx, 105
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.317
+.L.bb.cmul.316:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    imul rcx, 100
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.318:
+.L.bb.cmul.317:
+    mov rcx, 106
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.320
+.L.bb.cmul.319:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    imul rcx, 100
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.321:
+.L.bb.cmul.320:
+    mov rcx, 107
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.323
+.L.bb.cmul.322:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    imul rcx, -100
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.324:
+.L.bb.cmul.323:
+    mov rcx, 108
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.326
+.L.bb.cmul.325:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    imul rcx, -100
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.327:
+.L.bb.cmul.326:
+    mov rcx, 109
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.329
+.L.bb.cmul.328:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    imul rcx, 127
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.330:
+.L.bb.cmul.329:
+    mov rcx, 110
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.332
+.L.bb.cmul.331:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    imul rcx, 127
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.333:
+.L.bb.cmul.332:
+    mov rcx, 111
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.335
+.L.bb.cmul.334:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    imul rcx, -127
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.336:
+.L.bb.cmul.335:
+    mov rcx, 112
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.338
+.L.bb.cmul.337:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    imul rcx, -127
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.339:
+.L.bb.cmul.338:
+    mov rcx, 113
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.341
+.L.bb.cmul.340:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    shl rcx, 7
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.342:
+.L.bb.cmul.341:
+    mov rcx, 114
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.344
+.L.bb.cmul.343:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    shl rcx, 7
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.345:
+.L.bb.cmul.344:
+    mov rcx, 115
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.347
+.L.bb.cmul.346:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    shl rcx, 7
+    neg rcx
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.348:
+.L.bb.cmul.347:
+    mov rcx, 116
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.350
+.L.bb.cmul.349:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    shl rcx, 7
+    neg rcx
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.351:
+.L.bb.cmul.350:
+    mov rcx, 117
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.353
+.L.bb.cmul.352:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    imul rcx, 255
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.354:
+.L.bb.cmul.353:
+    mov rcx, 118
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.356
+.L.bb.cmul.355:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    imul rcx, 255
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.357:
+.L.bb.cmul.356:
+    mov rcx, 119
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.359
+.L.bb.cmul.358:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    imul rcx, -255
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.360:
+.L.bb.cmul.359:
+    mov rcx, 120
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.362
+.L.bb.cmul.361:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    imul rcx, -255
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.363:
+.L.bb.cmul.362:
+    mov rcx, 121
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.365
+.L.bb.cmul.364:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    imul rcx, 641
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.366:
+.L.bb.cmul.365:
+    mov rcx, 122
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.368
+.L.bb.cmul.367:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    imul rcx, 641
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.369:
+.L.bb.cmul.368:
+    mov rcx, 123
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.371
+.L.bb.cmul.370:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    imul rcx, -641
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.372:
+.L.bb.cmul.371:
+    mov rcx, 124
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.374
+.L.bb.cmul.373:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    imul rcx, -641
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.375:
+.L.bb.cmul.374:
+    mov rcx, 125
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.377
+.L.bb.cmul.376:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    imul rcx, 1000
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.378:
+.L.bb.cmul.377:
+    mov rcx, 126
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.380
+.L.bb.cmul.379:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    imul rcx, 1000
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.381:
+.L.bb.cmul.380:
+    mov rcx, 127
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.383
+.L.bb.cmul.382:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    imul rcx, -1000
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.384:
+.L.bb.cmul.383:
+    mov rcx, 128
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.386
+.L.bb.cmul.385:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    imul rcx, -1000
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.387:
+.L.bb.cmul.386:
+    mov rcx, 129
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.389
+.L.bb.cmul.388:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    shl rcx, 12
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.390:
+.L.bb.cmul.389:
+    mov rcx, 130
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.392
+.L.bb.cmul.391:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    shl rcx, 12
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.393:
+.L.bb.cmul.392:
+    mov rcx, 131
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.395
+.L.bb.cmul.394:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    shl rcx, 12
+    neg rcx
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.396:
+.L.bb.cmul.395:
+    mov rcx, 132
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.398
+.L.bb.cmul.397:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    shl rcx, 12
+    neg rcx
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.399:
+.L.bb.cmul.398:
+    mov rcx, 133
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.401
+.L.bb.cmul.400:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    imul rcx, 65537
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.402:
+.L.bb.cmul.401:
+    mov rcx, 134
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.404
+.L.bb.cmul.403:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    imul rcx, 65537
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.405:
+.L.bb.cmul.404:
+    mov rcx, 135
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.407
+.L.bb.cmul.406:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    imul rcx, -65537
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.408:
+.L.bb.cmul.407:
+    mov rcx, 136
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.410
+.L.bb.cmul.409:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    imul rcx, -65537
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.411:
+.L.bb.cmul.410:
+    mov rcx, 137
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.413
+.L.bb.cmul.412:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    imul rcx, 6700417
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.414:
+.L.bb.cmul.413:
+    mov rcx, 138
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.416
+.L.bb.cmul.415:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    imul rcx, 6700417
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.417:
+.L.bb.cmul.416:
+    mov rcx, 139
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.419
+.L.bb.cmul.418:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    imul rcx, -6700417
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.420:
+.L.bb.cmul.419:
+    mov rcx, 140
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.422
+.L.bb.cmul.421:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    imul rcx, -6700417
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.423:
+.L.bb.cmul.422:
+    mov rcx, 141
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.425
+.L.bb.cmul.424:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    imul rcx, 1000000007
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.426:
+.L.bb.cmul.425:
+    mov rcx, 142
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.428
+.L.bb.cmul.427:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    imul rcx, 1000000007
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.429:
+.L.bb.cmul.428:
+    mov rcx, 143
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.431
+.L.bb.cmul.430:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    imul rcx, -1000000007
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.432:
+.L.bb.cmul.431:
+    mov rcx, 144
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.434
+.L.bb.cmul.433:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    imul rcx, -1000000007
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.435:
+.L.bb.cmul.434:
+    mov rcx, 145
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.437
+.L.bb.cmul.436:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    imul rcx, 2147483647
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.438:
+.L.bb.cmul.437:
+    mov rcx, 146
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.440
+.L.bb.cmul.439:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    imul rcx, 2147483647
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.441:
+.L.bb.cmul.440:
+    mov rcx, 147
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.443
+.L.bb.cmul.442:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    imul rcx, -2147483647
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.444:
+.L.bb.cmul.443:
+    mov rcx, 148
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.446
+.L.bb.cmul.445:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    imul rcx, -2147483647
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.447:
+.L.bb.cmul.446:
+    mov rcx, 149
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.449
+.L.bb.cmul.448:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    shl rcx, 31
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.450:
+.L.bb.cmul.449:
+    mov rcx, 150
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.452
+.L.bb.cmul.451:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    shl rcx, 31
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.453:
+.L.bb.cmul.452:
+    mov rcx, 151
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.455
+.L.bb.cmul.454:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    shl rcx, 31
+    neg rcx
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.456:
+.L.bb.cmul.455:
+    mov rcx, 152
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.458
+.L.bb.cmul.457:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    shl rcx, 31
+    neg rcx
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.459:
+.L.bb.cmul.458:
+    mov rcx, 153
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.461
+.L.bb.cmul.460:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    shl rcx, 32
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.462:
+.L.bb.cmul.461:
+    mov rcx, 154
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.464
+.L.bb.cmul.463:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    shl rcx, 32
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.465:
+.L.bb.cmul.464:
+    mov rcx, 155
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.467
+.L.bb.cmul.466:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    shl rcx, 32
+    neg rcx
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.468:
+.L.bb.cmul.467:
+    mov rcx, 156
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.470
+.L.bb.cmul.469:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    shl rcx, 32
+    neg rcx
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.471:
+.L.bb.cmul.470:
+    mov rcx, 157
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.473
+.L.bb.cmul.472:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    shl rcx, 40
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.474:
+.L.bb.cmul.473:
+    mov rcx, 158
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.476
+.L.bb.cmul.475:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    shl rcx, 40
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.477:
+.L.bb.cmul.476:
+    mov rcx, 159
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.479
+.L.bb.cmul.478:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    shl rcx, 40
+    neg rcx
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.480:
+.L.bb.cmul.479:
+    mov rcx, 160
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.482
+.L.bb.cmul.481:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    shl rcx, 40
+    neg rcx
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.483:
+.L.bb.cmul.482:
+    mov rcx, 161
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.485
+.L.bb.cmul.484:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    shl rcx, 62
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.486:
+.L.bb.cmul.485:
+    mov rcx, 162
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.488
+.L.bb.cmul.487:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    shl rcx, 62
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.489:
+.L.bb.cmul.488:
+    mov rcx, 163
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.491
+.L.bb.cmul.490:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    shl rcx, 62
+    neg rcx
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.492:
+.L.bb.cmul.491:
+    mov rcx, 164
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.494
+.L.bb.cmul.493:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    shl rcx, 62
+    neg rcx
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.495:
+.L.bb.cmul.494:
+    mov rcx, 165
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.497
+.L.bb.cmul.496:
+    mov rcx, 9223372036854775807
+    lea rsi, [rbp - 8]
+    mov rsi, [rsi]
+    imul rsi, rcx
+    mov rax, rsi
+    jmp .L.return.cmul
+.L.bb.cmul.498:
+.L.bb.cmul.497:
+    mov rcx, 166
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.500
+.L.bb.cmul.499:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    mov rsi, 9223372036854775807
+    imul rsi, rcx
+    mov rax, rsi
+    jmp .L.return.cmul
+.L.bb.cmul.501:
+.L.bb.cmul.500:
+    mov rcx, 167
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.503
+.L.bb.cmul.502:
+    mov rcx, -9223372036854775807
+    lea rsi, [rbp - 8]
+    mov rsi, [rsi]
+    imul rsi, rcx
+    mov rax, rsi
+    jmp .L.return.cmul
+.L.bb.cmul.504:
+.L.bb.cmul.503:
+    mov rcx, 168
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.506
+.L.bb.cmul.505:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    mov rsi, -9223372036854775807
+    imul rsi, rcx
+    mov rax, rsi
+    jmp .L.return.cmul
+.L.bb.cmul.507:
+.L.bb.cmul.506:
+    mov rcx, 169
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.509
+.L.bb.cmul.508:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    shl rcx, 63
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.510:
+.L.bb.cmul.509:
+    mov rcx, 170
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.512
+.L.bb.cmul.511:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    shl rcx, 63
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.513:
+.L.bb.cmul.512:
+    mov rcx, 171
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.515
+.L.bb.cmul.514:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    shl rcx, 63
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.516:
+.L.bb.cmul.515:
+    mov rcx, 172
+    lea rsi, [rbp - 16]
+    mov rsi, [rsi]
+    cmp rsi, rcx
+    sete cl
+    movzb rcx, cl
+    cmp rcx, 0
+    je .L.bb.cmul.518
+.L.bb.cmul.517:
+    lea rcx, [rbp - 8]
+    mov rcx, [rcx]
+    shl rcx, 63
+    mov rax, rcx
+    jmp .L.return.cmul
+.L.bb.cmul.519:
+.L.bb.cmul.518:
+    mov rcx, 0
+    mov rax, rcx
+.L.return.cmul:
+    mov rsp, rbp
+    pop rbp
+    ret
@@ -0,0 +1,19 @@
+.intel_syntax noprefix
+    .globl main
+    .text
+main:
+    push rbp
+    mov rbp, rsp
+    sub rsp, 0
+    push 3
+    mov rax, 5
+    mov rsi, rax
+    pop rdi
+    mov rsp, rbp
+    pop rbp
+    mov rax, 0
+    jmp add
+.L.return.main:
+    mov rsp, rbp
+    pop rbp
+    ret
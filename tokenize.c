@@ -1,11 +1,5 @@
 #include "mcc.h"
 
-// Input filename
-char *current_filename;
-
-// Input string
-char *current_input;
-
 void error(char *fmt, ...) {
     va_list ap;
     va_start(ap, fmt);
@@ -17,21 +11,21 @@ void error(char *fmt, ...) {
 void verror_at(char *loc, char *fmt, va_list ap) {
     // Find a line containing `loc`
     char *line = loc;
-    while (current_input < line && line[-1] != '\n')
+    while (tu->input < line && line[-1] != '\n')
         line--;
 
     char *end = loc;
-    while (*end != '\n')
+    while (*end && *end != '\n')
         end++;
 
     // Get a line number
     int line_no = 1;
-    for (char *p = current_input; p < line; p++)
+    for (char *p = tu->input; p < line; p++)
         if (*p == '\n')
             line_no++;
 
     // Print out the line
-    int indent = fprintf(stderr, "%s:%d: ", current_filename, line_no);
+    int indent = fprintf(stderr, "%s:%d: ", tu->filename, line_no);
     fprintf(stderr, "%.*s\n", (int)(end - line), line);
 
     int pos = loc - line + indent;
@@ -54,18 +48,27 @@ void error_tok(Token *tok, char *fmt, ...) {
     verror_at(tok->loc, fmt, ap);
 }
 
-bool equal(Token *tok, char *str) {
-    return strncmp(tok->loc, str, tok->len) == 0 && str[tok->len] == '\0';
-}
-
-Token *skip(Token *tok, char *str) {
-    if (!equal(tok, str))
-        error_at(tok->loc, "expected '%s'", str);
+// Spellings of multi-character punctuators and keywords
+static char *token_names[] = {
+    [PU_EQ] = "==",         [PU_NE] = "!=",
+    [PU_LE] = "<=",         [PU_GE] = ">=",
+    [KW_RETURN] = "return", [KW_IF] = "if",
+    [KW_ELSE] = "else",     [KW_FOR] = "for",
+    [KW_WHILE] = "while",   [KW_INT] = "int",
+    [KW_SIZEOF] = "sizeof", [KW_CHAR] = "char",
+};
+
+Token *skip(Token *tok, int id) {
+    if (tok->id != id) {
+        if (id < PU_EQ)
+            error_at(tok->loc, "expected '%c'", id);
+        error_at(tok->loc, "expected '%s'", token_names[id]);
+    }
     return tok->next;
 }
 
-bool consume(Token **rest, Token *tok, char *str) {
-    if (equal(tok, str)) {
+bool consume(Token **rest, Token *tok, int id) {
+    if (tok->id == id) {
         *rest = tok->next;
         return true;
     }
@@ -75,13 +78,26 @@ bool consume(Token **rest, Token *tok, char *str) {
 
 // Create a new token
 Token *new_token(TokenKind kind, char *start, char *end) {
-    Token *tok = calloc(1, sizeof(Token));
+    Token *tok = arena_alloc(&tu->token_arena, sizeof(Token));
+    tu->num_tokens++;
     tok->kind = kind;
     tok->loc = start;
     tok->len = end - start;
     return tok;
 }
 
+// Returns the unique copy of the given identifier, so that two
+// identifiers can be compared by address.
+char *intern(char *s, int len) {
+    char *name = hashmap_get2(&tu->idents, s, len);
+    if (name)
+        return name;
+
+    name = arena_strndup(&tu->token_arena, s, len);
+    hashmap_put2(&tu->idents, name, len, name);
+    return name;
+}
+
 bool startswith(char *p, char *q) { return strncmp(p, q, strlen(q)) == 0; }
 
 // Returns true if c is valid as the first character of an identifier
@@ -100,21 +116,60 @@ int from_hex(char c) {
     return c - 'A' + 10;
 }
 
-// Read a punctuator token from p and returns its length
-int read_punct(char *p) {
-    if (startswith(p, "==") || startswith(p, "!=") || startswith(p, "<=") ||
-        startswith(p, ">="))
-        return 2;
+// Read a punctuator token from p and returns its length. Its ID is
+// stored to `id`.
+int read_punct(char *p, int *id) {
+    if (p[1] == '=') {
+        switch (*p) {
+        case '=':
+            *id = PU_EQ;
+            return 2;
+        case '!':
+            *id = PU_NE;
+            return 2;
+        case '<':
+            *id = PU_LE;
+            return 2;
+        case '>':
+            *id = PU_GE;
+            return 2;
+        }
+    }
+
+    *id = (unsigned char)*p;
     return ispunct(*p) ? 1 : 0;
 }
 
-bool is_keyword(Token *tok) {
-    static char *kw[] = {"return", "if",     "else", "for", "while",
-                         "int",    "sizeof", "char", NULL};
-    for (int i = 0; kw[i]; i++)
-        if (equal(tok, kw[i]))
-            return true;
-    return false;
+// Keywords are found with a perfect hash: kw_hash() maps each keyword
+// to a distinct slot of kw_table, so an identifier needs at most one
+// string comparison. init_keywords() verifies that there are no
+// collisions; a new keyword may require adjusting the hash function.
+#define KW_HASH_SIZE 16
+
+static int kw_table[KW_HASH_SIZE];
+
+static int kw_hash(char *p, int len) {
+    return (len * 4 + (unsigned char)p[0] + (unsigned char)p[len - 1]) &
+           (KW_HASH_SIZE - 1);
+}
+
+static void init_keywords(void) {
+    int nnames = sizeof(token_names) / sizeof(*token_names);
+    for (int id = KW_RETURN; id < nnames; id++) {
+        char *name = token_names[id];
+        int h = kw_hash(name, strlen(name));
+        if (kw_table[h])
+            error("internal error: keyword hash collision: %s", name);
+        kw_table[h] = id;
+    }
+}
+
+// Returns the keyword ID for an identifier, or 0 if it is not a keyword
+static int keyword_id(char *p, int len) {
+    int id = kw_table[kw_hash(p, len)];
+    if (id && !strncmp(token_names[id], p, len) && !token_names[id][len])
+        return id;
+    return 0;
 }
 
 int read_escaped_char(char **new_pos, char *p) {
@@ -183,7 +238,7 @@ char *string_literal_end(char *p) {
 
 Token *read_string_literal(char *start) {
     char *end = string_literal_end(start + 1);
-    char *buf = calloc(1, end - start);
+    char *buf = arena_alloc(&tu->token_arena, end - start);
     int len = 0;
 
     for (char *p = start + 1; p < end;) {
@@ -199,16 +254,13 @@ Token *read_string_literal(char *start) {
     return tok;
 }
 
-void convert_keywords(Token *tok) {
-    for (Token *t = tok; t->kind != TK_EOF; t = t->next)
-        if (is_keyword(t))
-            t->kind = TK_KEYWORD;
-}
-
 // Tokenize `p` and returns new tokens
 Token *tokenize(char *filename, char *p) {
-    current_filename = filename;
-    current_input = p;
+    static pthread_once_t once = PTHREAD_ONCE_INIT;
+    pthread_once(&once, init_keywords);
+
+    tu->filename = filename;
+    tu->input = p;
     Token head = {};
     Token *cur = &head;
 
@@ -216,7 +268,7 @@ Token *tokenize(char *filename, char *p) {
         // Skip line comments
         if (startswith(p, "//")) {
             p += 2;
-            while (*p != '\n')
+            while (*p && *p != '\n')
                 p++;
             continue;
         }
@@ -259,13 +311,19 @@ Token *tokenize(char *filename, char *p) {
                 p++;
             } while (is_ident2(*p));
             cur = cur->next = new_token(TK_IDENT, start, p);
+            cur->ident = intern(start, p - start);
+            cur->id = keyword_id(start, p - start);
+            if (cur->id)
+                cur->kind = TK_KEYWORD;
             continue;
         }
 
         // Punctuators
-        int punct_len = read_punct(p);
+        int id;
+        int punct_len = read_punct(p, &id);
         if (punct_len) {
             cur = cur->next = new_token(TK_PUNCT, p, p + punct_len);
+            cur->id = id;
             p += cur->len;
             continue;
         }
@@ -274,46 +332,86 @@ Token *tokenize(char *filename, char *p) {
     }
 
     cur = cur->next = new_token(TK_EOF, p, p);
-    convert_keywords(head.next);
     return head.next;
 }
 
-// Returns the contents of a given file
-char *read_file(char *path) {
-    FILE *fp;
-
-    if (strcmp(path, "-") == 0) {
-        // By convention, read from stdin if a given filename is "-"
-        fp = stdin;
-    } else {
-        fp = fopen(path, "r");
-        if (!fp)
-            error("cannot open %s: %s", path, strerror(errno));
+// Map a regular file read-only. The input must be terminated by '\0',
+// so we first reserve zero-filled address space one byte larger than the
+// file and then map the file over its beginning. If the file does not end
+// on a page boundary, the kernel zero-fills the rest of its last page;
+// otherwise the extra anonymous page provides the terminator.
+static size_t map_len(size_t size) {
+    size_t pagesize = sysconf(_SC_PAGESIZE);
+    return (size + pagesize) / pagesize * pagesize;
+}
+
+static char *map_file(int fd, size_t size) {
+    size_t len = map_len(size);
+
+    char *buf = mmap(NULL, len, PROT_READ, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (buf == MAP_FAILED)
+        return NULL;
+
+    if (size > 0 && mmap(buf, size, PROT_READ, MAP_PRIVATE | MAP_FIXED, fd,
+                         0) == MAP_FAILED) {
+        munmap(buf, len);
+        return NULL;
     }
+    return buf;
+}
 
+// Read an entire stream into a '\0'-terminated buffer. Used for stdin
+// and other inputs that cannot be mapped.
+static char *read_stream(FILE *fp) {
     char *buf;
     size_t buflen;
     FILE *out = open_memstream(&buf, &buflen);
 
-    // Read the entire file
     for (;;) {
-        char buf2[4096];
+        char buf2[65536];
         int n = fread(buf2, 1, sizeof(buf2), fp);
         if (n == 0)
             break;
         fwrite(buf2, 1, n, out);
     }
 
-    if (fp != stdin)
-        fclose(fp);
-
-    // Make sure that the last line is properly terminated with '\n'
-    fflush(out);
-    if (buflen == 0 || buf[buflen - 1] != '\n')
-        fputc('\n', out);
     fputc('\0', out);
     fclose(out);
     return buf;
 }
 
-Token *tokenize_file(char *path) { return tokenize(path, read_file(path)); }
\ No newline at end of file
+// Returns the contents of a given file. If the file is mmap'ed, the
+// length of the mapping is stored to `*mapped`.
+char *read_file(char *path, size_t *mapped) {
+    *mapped = 0;
+
+    // By convention, read from stdin if a given filename is "-"
+    if (strcmp(path, "-") == 0)
+        return read_stream(stdin);
+
+    int fd = open(path, O_RDONLY);
+    if (fd == -1)
+        error("cannot open %s: %s", path, strerror(errno));
+
+    struct stat st;
+    if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode)) {
+        char *buf = map_file(fd, st.st_size);
+        if (buf) {
+            close(fd);
+            *mapped = map_len(st.st_size);
+            return buf;
+        }
+    }
+
+    FILE *fp = fdopen(fd, "r");
+    if (!fp)
+        error("cannot open %s: %s", path, strerror(errno));
+    char *buf = read_stream(fp);
+    fclose(fp);
+    return buf;
+}
+
+Token *tokenize_file(char *path) {
+    char *p = read_file(path, &tu->input_mapped);
+    return tokenize(path, p);
+}
\ No newline at end of file
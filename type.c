@@ -6,13 +6,13 @@ Type *ty_int = &(Type){TY_INT, 8};
 bool is_integer(Type *ty) { return ty->kind == TY_CHAR || ty->kind == TY_INT; }
 
 Type *copy_type(Type *ty) {
-    Type *ret = calloc(1, sizeof(Type));
+    Type *ret = arena_alloc(&tu->type_arena, sizeof(Type));
     *ret = *ty;
     return ret;
 }
 
 Type *pointer_to(Type *base) {
-    Type *ty = calloc(1, sizeof(Type));
+    Type *ty = arena_alloc(&tu->type_arena, sizeof(Type));
     ty->kind = TY_PTR;
     ty->size = 8;
     ty->base = base;
@@ -20,14 +20,14 @@ Type *pointer_to(Type *base) {
 }
 
 Type *func_type(Type *return_ty) {
-    Type *ty = calloc(1, sizeof(Type));
+    Type *ty = arena_alloc(&tu->type_arena, sizeof(Type));
     ty->kind = TY_FUNC;
     ty->return_ty = return_ty;
     return ty;
 }
 
 Type *array_of(Type *base, int len) {
-    Type *ty = calloc(1, sizeof(Type));
+    Type *ty = arena_alloc(&tu->type_arena, sizeof(Type));
     ty->kind = TY_ARRAY;
     ty->size = base->size * len;
     ty->base = base;
@@ -0,0 +1,76 @@
+#include "mcc.h"
+
+// Translation units. A unit owns everything the compiler creates for a
+// file, and all of it is released by free_unit().
+
+_Thread_local TransUnit *tu;
+
+// Arenas of a unit in the order -fmem-stats lists them
+static size_t arena_fields[] = {
+    offsetof(TransUnit, token_arena), offsetof(TransUnit, type_arena),
+    offsetof(TransUnit, node_arena),  offsetof(TransUnit, scope_arena),
+    offsetof(TransUnit, insn_arena),  offsetof(TransUnit, code_arena),
+};
+
+static char *arena_names[] = {"token", "type", "node",
+                              "scope", "insn", "code"};
+
+#define NUM_ARENAS (int)(sizeof(arena_fields) / sizeof(*arena_fields))
+
+// Usage of the arenas of all units freed so far
+static Arena totals[NUM_ARENAS];
+static pthread_mutex_t totals_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static Arena *get_arena(TransUnit *unit, int i) {
+    return (Arena *)((char *)unit + arena_fields[i]);
+}
+
+TransUnit *new_unit(char *filename) {
+    TransUnit *unit = calloc(1, sizeof(TransUnit));
+    if (!unit)
+        error("out of memory");
+    unit->filename = filename;
+    unit->symtab.by_ptr = true;
+    for (int i = 0; i < NUM_ARENAS; i++)
+        get_arena(unit, i)->name = arena_names[i];
+    return unit;
+}
+
+void free_unit(TransUnit *unit) {
+    pthread_mutex_lock(&totals_lock);
+    for (int i = 0; i < NUM_ARENAS; i++) {
+        Arena *a = get_arena(unit, i);
+        totals[i].bytes += a->bytes;
+        totals[i].objects += a->objects;
+        totals[i].reserved += a->reserved;
+        arena_free(a);
+    }
+    pthread_mutex_unlock(&totals_lock);
+
+    hashmap_free(&unit->idents);
+    hashmap_free(&unit->symtab);
+    if (unit->input_mapped)
+        munmap(unit->input, unit->input_mapped);
+    else
+        free(unit->input);
+    free(unit);
+}
+
+// Print the number of bytes and objects handed out by each arena,
+// summed over all units that have been freed
+void print_mem_stats(FILE *out) {
+    size_t bytes = 0, objects = 0, reserved = 0;
+
+    fprintf(out, "%-8s %12s %10s %12s\n", "arena", "bytes", "objects",
+            "reserved");
+    for (int i = 0; i < NUM_ARENAS; i++) {
+        Arena *a = &totals[i];
+        fprintf(out, "%-8s %12zu %10zu %12zu\n", arena_names[i], a->bytes,
+                a->objects, a->reserved);
+        bytes += a->bytes;
+        objects += a->objects;
+        reserved += a->reserved;
+    }
+    fprintf(out, "%-8s %12zu %10zu %12zu\n", "total", bytes, objects,
+            reserved);
+}
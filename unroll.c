@@ -0,0 +1,242 @@
+#include "mcc.h"
+
+// Loop unrolling (-funroll-loops). A counted loop
+//
+//   for (init; i < n; i = i + c) body
+//
+// where nothing but the increment changes `i` or `n` is rewritten as
+//
+//   init;
+//   for (; i < n - (N-1)*c; i = i + c) { body; i = i + c; ... body }
+//   for (; i < n; i = i + c) body
+//
+// so that the loop overhead is paid once per N iterations. The second
+// loop runs the iterations that are left over. As with any wrapping
+// arithmetic, the unrolled loop is wrong if n - (N-1)*c overflows, which
+// only bounds within (N-1)*c of the minimum value can do.
+//
+// Only innermost loops are unrolled, and the factor is reduced so that
+// the unrolled body stays within a fixed number of nodes. Loops that
+// the vectorizer takes are left alone.
+
+int opt_unroll; // Unroll factor, or 0 to not unroll
+
+#define MAX_UNROLLED_NODES 128
+
+static int count_nodes(Node *node) {
+    if (!node)
+        return 0;
+
+    int n = 1;
+    n += count_nodes(node->lhs) + count_nodes(node->rhs);
+    n += count_nodes(node->cond) + count_nodes(node->then);
+    n += count_nodes(node->els) + count_nodes(node->init);
+    n += count_nodes(node->inc);
+    for (Node *n2 = node->body; n2; n2 = n2->next)
+        n += count_nodes(n2);
+    for (Node *n2 = node->args; n2; n2 = n2->next)
+        n += count_nodes(n2);
+    return n;
+}
+
+// Returns true if `node` contains a loop
+static bool has_loop(Node *node) {
+    if (!node)
+        return false;
+    if (node->kind == ND_FOR)
+        return true;
+    if (has_loop(node->then) || has_loop(node->els))
+        return true;
+    for (Node *n = node->body; n; n = n->next)
+        if (has_loop(n))
+            return true;
+    return false;
+}
+
+// Returns true if `node` contains an assignment to `var` or takes its
+// address, depending on `kind`
+static bool has_op(Node *node, NodeKind kind, Obj *var) {
+    if (!node)
+        return false;
+    if (node->kind == kind && node->lhs->kind == ND_VAR &&
+        node->lhs->var == var)
+        return true;
+
+    if (has_op(node->lhs, kind, var) || has_op(node->rhs, kind, var) ||
+        has_op(node->cond, kind, var) || has_op(node->then, kind, var) ||
+        has_op(node->els, kind, var) || has_op(node->init, kind, var) ||
+        has_op(node->inc, kind, var))
+        return true;
+    for (Node *n = node->body; n; n = n->next)
+        if (has_op(n, kind, var))
+            return true;
+    for (Node *n = node->args; n; n = n->next)
+        if (has_op(n, kind, var))
+            return true;
+    return false;
+}
+
+// Returns true if `var` is a local of `fn` that the body of `loop`
+// doesn't assign to and that no pointer points to
+bool is_private_local(Node *loop, Obj *var, Obj *fn) {
+    return var->is_local && !var->is_addr_taken &&
+           !has_op(loop->then, ND_ASSIGN, var);
+}
+
+static Node *copy_node(Node *node);
+
+static Node *copy_list(Node *node) {
+    Node head = {};
+    Node *cur = &head;
+    for (; node; node = node->next)
+        cur = cur->next = copy_node(node);
+    return head.next;
+}
+
+static Node *copy_node(Node *node) {
+    if (!node)
+        return NULL;
+
+    Node *copy = new_node(node->kind, node->tok);
+    *copy = *node;
+    copy->next = NULL;
+    copy->lhs = copy_node(node->lhs);
+    copy->rhs = copy_node(node->rhs);
+    copy->cond = copy_node(node->cond);
+    copy->then = copy_node(node->then);
+    copy->els = copy_node(node->els);
+    copy->init = copy_node(node->init);
+    copy->inc = copy_node(node->inc);
+    copy->body = copy_list(node->body);
+    copy->args = copy_list(node->args);
+    return copy;
+}
+
+static bool is_var(Node *node, Obj *var) {
+    return node->kind == ND_VAR && node->var == var;
+}
+
+// Returns the step of an increment "i = i + c" with c > 0, or 0
+static long get_step(Node *inc, Obj *var) {
+    if (!inc || inc->kind != ND_ASSIGN || !is_var(inc->lhs, var) ||
+        inc->rhs->kind != ND_ADD)
+        return 0;
+
+    Node *add = inc->rhs;
+    if (!is_var(add->lhs, var) && !is_var(add->rhs, var))
+        return 0;
+    Node *step = is_var(add->lhs, var) ? add->rhs : add->lhs;
+    if (step->kind != ND_NUM || step->val <= 0)
+        return 0;
+    return step->val;
+}
+
+// Returns true if `node` is a loop "for (init; i < n; i = i + c)" or
+// "for (init; i <= n; i = i + c)" in `fn` where n is a constant or a
+// local, c > 0 and only the increment changes i or n. Sets *step to c.
+bool is_counted_loop(Node *node, Obj *fn, long *step) {
+    Node *cond = node->cond;
+    if (node->kind != ND_FOR || !cond ||
+        (cond->kind != ND_LT && cond->kind != ND_LE) ||
+        cond->lhs->kind != ND_VAR)
+        return false;
+
+    // The induction variable must be a full-width integer, so that it
+    // wraps the same way however many steps are taken at once
+    Obj *var = cond->lhs->var;
+    *step = get_step(node->inc, var);
+    if (!*step || !is_integer(var->ty) || var->ty->size != 8 ||
+        !is_private_local(node, var, fn))
+        return false;
+
+    Node *bound = cond->rhs;
+    if (bound->kind == ND_NUM)
+        return true;
+    return bound->kind == ND_VAR && bound->var != var &&
+           is_integer(bound->var->ty) && is_private_local(node, bound->var, fn);
+}
+
+// Unroll `node` if it is a counted loop, in `fn`
+static void unroll_loop(Node *node, Obj *fn) {
+    long step;
+    VecLoop vl;
+    if (!is_counted_loop(node, fn, &step) || is_vector_loop(node, fn, &vl))
+        return;
+
+    Node *cond = node->cond;
+    Node *bound = cond->rhs;
+    int size = count_nodes(node->then) + count_nodes(node->inc);
+    int factor = opt_unroll;
+    if (factor * size > MAX_UNROLLED_NODES)
+        factor = MAX_UNROLLED_NODES / size;
+    if (factor < 2 || step > LONG_MAX / factor)
+        return;
+
+    long span = step * (factor - 1);
+    Token *tok = node->tok;
+    Node *limit;
+    if (bound->kind == ND_NUM) {
+        if (bound->val < LONG_MIN + span)
+            return;
+        limit = new_num(bound->val - span, tok);
+    } else {
+        limit = new_binary(ND_SUB, copy_node(bound), new_num(span, tok), tok);
+    }
+
+    // The unrolled loop
+    Node head = {};
+    Node *cur = &head;
+    for (int i = 0; i < factor; i++) {
+        if (i > 0) {
+            cur = cur->next = new_node(ND_EXPR_STMT, tok);
+            cur->lhs = copy_node(node->inc);
+        }
+        cur = cur->next = copy_node(node->then);
+    }
+
+    Node *unrolled = new_node(ND_FOR, tok);
+    unrolled->cond = new_binary(cond->kind, copy_node(cond->lhs), limit, tok);
+    unrolled->inc = copy_node(node->inc);
+    unrolled->then = new_node(ND_BLOCK, tok);
+    unrolled->then->body = head.next;
+
+    // The original loop, without its initializer, finishes the rest
+    Node *rest = new_node(ND_FOR, tok);
+    *rest = *node;
+    rest->next = NULL;
+    rest->init = NULL;
+
+    Node *init = node->init;
+    if (!init)
+        init = new_node(ND_BLOCK, tok);
+    init->next = unrolled;
+    unrolled->next = rest;
+
+    node->kind = ND_BLOCK;
+    node->body = init;
+}
+
+static void unroll_stmt(Node *node, Obj *fn) {
+    switch (node->kind) {
+    case ND_FOR:
+        unroll_stmt(node->then, fn);
+        if (!has_loop(node->then))
+            unroll_loop(node, fn);
+        return;
+    case ND_IF:
+        unroll_stmt(node->then, fn);
+        if (node->els)
+            unroll_stmt(node->els, fn);
+        return;
+    case ND_BLOCK:
+        for (Node *n = node->body; n; n = n->next)
+            unroll_stmt(n, fn);
+        return;
+    }
+}
+
+void unroll(Obj *prog) {
+    for (Obj *fn = prog; fn; fn = fn->next)
+        if (fn->is_function)
+            unroll_stmt(fn->body, fn);
+}
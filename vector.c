@@ -0,0 +1,114 @@
+#include "mcc.h"
+
+// Loop vectorization. An innermost counted loop whose body is a single
+// assignment
+//
+//   for (init; i < n; i = i + 1) a[i] = b[i] + c[i] - ...;
+//
+// over arrays of one element size is lowered to a loop that processes
+// a whole SSE2 vector (16 bytes) or, with -mavx2, an AVX2 vector
+// (32 bytes) of elements per iteration, followed by the original loop,
+// which runs the iterations that are left over. See lower_vector_loop()
+// in ir.c.
+//
+// Elements are only added and subtracted, which is the same on the
+// lanes of a vector as on the low bytes of full-width values. Each
+// element is read at index i only, so iterations don't depend on each
+// other unless a[] overlaps one of the sources in such a way that a
+// store feeds a later load. Unless both are distinct arrays, this is
+// checked at run time before entering the vector loop.
+
+bool opt_vectorize = true;
+bool opt_avx2;
+
+// Size of a vector register in bytes
+int vector_size(void) { return opt_avx2 ? 32 : 16; }
+
+// Keep vector temporaries within the 16 vector registers
+#define MAX_LEAVES 8
+
+// Returns the array or pointer variable that `node` indexes, if it is
+// `x[i]` with elements of `size` bytes, or NULL
+static Obj *get_base(Node *node, Obj *iv, int size) {
+    if (node->kind != ND_DEREF || !is_integer(node->ty) ||
+        node->ty->size != size || node->lhs->kind != ND_ADD)
+        return NULL;
+
+    Node *base = node->lhs->lhs;
+    Node *idx = node->lhs->rhs;
+    if (base->kind != ND_VAR || !base->ty->base)
+        return NULL;
+
+    // x[i] is *(x + i * size), where fold() has removed "* 1"
+    if (idx->kind == ND_MUL && idx->rhs->kind == ND_NUM &&
+        idx->rhs->val == size)
+        idx = idx->lhs;
+    if (idx->kind != ND_VAR || idx->var != iv)
+        return NULL;
+    return base->var;
+}
+
+// Returns true if `var` can be the base of a vector access in `loop`
+static bool is_base(Node *loop, Obj *var, Obj *fn) {
+    // A pointer must not change during the loop
+    return var->ty->kind == TY_ARRAY || is_private_local(loop, var, fn);
+}
+
+// Count the leaves of an expression of additions and subtractions of
+// array elements, or return -1 if it is something else
+static int count_leaves(Node *node, Node *loop, Obj *fn, VecLoop *vl) {
+    if (node->kind == ND_ADD || node->kind == ND_SUB) {
+        if (!is_integer(node->ty))
+            return -1;
+        int l = count_leaves(node->lhs, loop, fn, vl);
+        int r = count_leaves(node->rhs, loop, fn, vl);
+        return l < 0 || r < 0 ? -1 : l + r;
+    }
+
+    Obj *base = get_base(node, vl->iv->var, vl->elem_size);
+    return base && is_base(loop, base, fn) ? 1 : -1;
+}
+
+// Returns true if `node` is a loop that can be vectorized, and
+// describes it in *vl
+bool is_vector_loop(Node *node, Obj *fn, VecLoop *vl) {
+    long step;
+    if (!opt_vectorize || !opt_regalloc ||
+        !is_counted_loop(node, fn, &step) || step != 1)
+        return false;
+
+    Node *body = node->then;
+    if (body->kind == ND_BLOCK && body->body && !body->body->next)
+        body = body->body;
+    if (body->kind != ND_EXPR_STMT || body->lhs->kind != ND_ASSIGN)
+        return false;
+
+    Node *store = body->lhs;
+    Node *dst = store->lhs;
+    vl->iv = node->cond->lhs;
+    vl->bound = node->cond->rhs;
+    vl->cmp = node->cond->kind;
+    vl->store = store;
+    vl->elem_size = dst->ty->size;
+    vl->lanes = vector_size() / vl->elem_size;
+
+    if (vl->elem_size != 1 && vl->elem_size != 8)
+        return false;
+
+    Obj *base = get_base(dst, vl->iv->var, vl->elem_size);
+    if (!base || !is_base(node, base, fn))
+        return false;
+
+    int n = count_leaves(store->rhs, node, fn, vl);
+    return n > 0 && n <= MAX_LEAVES;
+}
+
+// Returns true if the array accesses `x` and `y` may refer to
+// overlapping but different memory
+bool may_overlap(Node *x, Node *y) {
+    Obj *a = x->lhs->lhs->var;
+    Obj *b = y->lhs->lhs->var;
+    if (a == b)
+        return false;
+    return a->ty->kind != TY_ARRAY || b->ty->kind != TY_ARRAY;
+}